@@ -5,30 +5,56 @@
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <utility>
+
+#include "container_stats.h"
 // Note: #include <iostream> only needed for the traversal-print functions (in case you pass e.g std::cout as argument)
 
 /* Basic implementation of a simple AVL Tree data structure. A lot of "Standard" functions and overloads are missing. */
-/* Iterators are missing on purpose as well: this implementation is supposed to be read by beginners unlike the previous ones, and also, this is only meant for learning purposes. */
+/* In-order iterators walk the parent pointers iteratively (no recursion, no auxiliary stack), so scanning a
+   range between lower_bound() and upper_bound() is a tight pointer-chasing loop even on huge trees. */
 
 
 namespace container {
-	template<typename Key>
+	template<typename Key, typename Allocator = std::allocator<Key>>
 	class AVL {
 	private:
 		struct Node {
 			Node* left = nullptr;
 			Node* right = nullptr;
-			Node* parent;
+			Node* parent = nullptr;
 			Key data;
-			int balance_factor;
+			int balance_factor = 0;
+			int height = 0;		// Cached subtree height: a leaf is 0, a missing child counts as -1
 			template<typename...Args>
 			constexpr Node(Args&&...args) : data{ std::forward<Args>(args)... } {}
 		};
 
-		Node* m_root;
+		// The allocator is given to us for Key but what we allocate are Nodes: rebind it and go
+		// through allocator_traits, like the other node-based containers. A
+		// std::pmr::monotonic_buffer_resource turns the per-node new/delete into arena bumps.
+		using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+		using node_alloc_traits = std::allocator_traits<node_allocator>;
+
+		Node* m_root{};
 		std::size_t m_size{};
+		[[no_unique_address]] avl_stats m_stats;	// Empty unless CONTAINER_INSTRUMENTATION (see container_stats.h)
+		node_allocator m_allocator{};
+
+		template<typename...Args>
+		constexpr Node* create_node(Args&&...args) {
+			Node* node = node_alloc_traits::allocate(m_allocator, 1);
+			node_alloc_traits::construct(m_allocator, node, std::forward<Args>(args)...);
+			return node;
+		}
+
+		constexpr void destroy_node(Node* node) noexcept {
+			node_alloc_traits::destroy(m_allocator, node);
+			node_alloc_traits::deallocate(m_allocator, node, 1);
+		}
 
 	public:
 		using key_type = Key;
@@ -41,27 +67,47 @@ namespace container {
 		using const_pointer = const pointer;
 
 	private:
-		constexpr int get_height(const Node* root) const {
-			if (root == nullptr) return -1;
-			/* Keep going deeper into the tree until either root->left or root->right is nullptr.
-			Since both left and right substrees are checked, the deepest-node will be added 1 thanks to stack unwinding. */
-			return std::max(get_height(root->left), get_height(root->right)) + 1;
+		/* O(1): every Node caches its subtree height, maintained on the way back up from every
+		insertion/removal and inside the rotations. This used to recursively walk the entire subtree
+		on each call - and insert() called it twice per node on the unwinding path, making a single
+		insert O(n) instead of O(log n). */
+		constexpr int get_height(const Node* root) const noexcept {
+			return root == nullptr ? -1 : root->height;
+		}
+
+		// Recomputes one node's cached height from its (already correct) children
+		constexpr void update_height(Node* node) noexcept {
+			node->height = std::max(get_height(node->left), get_height(node->right)) + 1;
 		}
 
 		constexpr void rotate_right(Node* (&node)) noexcept {
+			CONTAINER_STATS(++m_stats.rotations_right);
 			Node* updated_root = node->left;
 			Node* temp = updated_root->right;
+			// The promoted node takes over the demoted one's parent slot (the iterators rely on these)
+			updated_root->parent = node->parent;
+			node->parent = updated_root;
+			if (temp != nullptr) temp->parent = node;
 			updated_root->right = node;
 			node->left = temp;
 			node = updated_root;
+			// Only these two nodes changed children; demoted node first since the root depends on it
+			update_height(node->right);
+			update_height(node);
 		}
 
 		constexpr void rotate_left(Node* (&node)) noexcept {
+			CONTAINER_STATS(++m_stats.rotations_left);
 			Node* updated_root = node->right;
 			Node* temp = updated_root->left;
+			updated_root->parent = node->parent;
+			node->parent = updated_root;
+			if (temp != nullptr) temp->parent = node;
 			updated_root->left = node;
 			node->right = temp;
 			node = updated_root;
+			update_height(node->left);
+			update_height(node);
 		}
 
 		constexpr void rebalance(Node*& current, const Key& data) {
@@ -81,22 +127,196 @@ namespace container {
 			}
 		}
 
-		constexpr void insert(Node*& current, const Key& data) {
+		// Returns whether a node was actually added, so the callers can keep m_size honest
+		// (duplicates used to be counted even though they are never stored)
+		constexpr bool insert(Node*& current, Node* parent, const Key& data) {
+			bool inserted;
 			if (current == nullptr) {
-				current = new Node(data);
+				current = create_node(data);
+				current->parent = parent;
+				return true;
 			}
 
 			else if (data < current->data) {
-				insert(current->left, data);
+				inserted = insert(current->left, current, data);
 			}
 			else if (data > current->data) {
-				insert(current->right, data);
+				inserted = insert(current->right, current, data);
 			}
-			else return; // Disallow duplicate elements
+			else return false; // Disallow duplicate elements
 
-			// Update the current's Node balance_factor. O(n) due to get_height()
+			// Update the current Node's cached height and balance_factor - O(1) now
+			update_height(current);
 			current->balance_factor = get_height(current->left) - get_height(current->right);
 			rebalance(current, data);
+			return inserted;
+		}
+
+		/* Builds a perfectly balanced subtree from `count` elements of a sorted range in O(n):
+		the recursion consumes the iterator strictly in order (left subtree, own element, right
+		subtree), so it works with forward iterators and never rotates - the shape is balanced by
+		construction. Heights and balance factors are filled in on the way back up. */
+		template<typename input_iter>
+		constexpr Node* build_sorted(input_iter& first, size_type count) {
+			if (count == 0) { return nullptr; }
+			const size_type left_count = count / 2;
+			Node* left = build_sorted(first, left_count);
+			Node* node = create_node(*first);
+			++first;
+			node->left = left;
+			if (left != nullptr) left->parent = node;
+			node->right = build_sorted(first, count - left_count - 1);
+			if (node->right != nullptr) node->right->parent = node;
+			update_height(node);
+			node->balance_factor = get_height(node->left) - get_height(node->right);
+			return node;
+		}
+
+		/* In-order iterator over the tree, walking the parent pointers (maintained by insert/erase
+		and the rotations) instead of recursing: each step is a handful of pointer chases with no
+		call stack and no heap-allocated traversal stack, and a full scan crosses every edge at most
+		twice, so ++ is O(1) amortized. Keys are exposed as const like std::set does - writing
+		through an iterator could break the ordering invariant. The iterator remembers which tree
+		it came from so that --end() lands on the maximum; decrementing begin() is not supported. */
+		class InOrderIterator {
+		private:
+			const Node* m_iterator;
+			const AVL* m_tree;
+
+		public:
+			using value_type = Key;
+			using reference = const Key&;
+			using pointer = const Key*;
+			using iterator_category = std::bidirectional_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+
+			constexpr InOrderIterator(const Node* node = nullptr, const AVL* tree = nullptr) noexcept
+				: m_iterator{ node }, m_tree{ tree } {}
+
+			constexpr const Node* getNodeAddress() const noexcept { return m_iterator; }
+			constexpr reference operator*() const noexcept { return m_iterator->data; }
+			constexpr pointer operator->() const noexcept { return &m_iterator->data; }
+
+			// In-order successor: leftmost node of the right subtree if there is one, otherwise the
+			// first ancestor reached from its left side (nullptr past the maximum, which is end())
+			constexpr InOrderIterator& operator++() noexcept {
+				if (m_iterator->right != nullptr) {
+					m_iterator = m_iterator->right;
+					while (m_iterator->left != nullptr) {
+						m_iterator = m_iterator->left;
+					}
+				}
+				else {
+					const Node* parent = m_iterator->parent;
+					while (parent != nullptr && m_iterator == parent->right) {
+						m_iterator = parent;
+						parent = parent->parent;
+					}
+					m_iterator = parent;
+				}
+				return *this;
+			}
+			constexpr InOrderIterator operator++(int) noexcept {
+				InOrderIterator tmp(*this);
+				++(*this);
+				return tmp;
+			}
+			// Mirror image of operator++, except that end() (a null node) steps back onto the
+			// rightmost node of the tree the iterator came from
+			constexpr InOrderIterator& operator--() noexcept {
+				if (m_iterator == nullptr) {
+					m_iterator = m_tree->m_root;
+					while (m_iterator->right != nullptr) {
+						m_iterator = m_iterator->right;
+					}
+				}
+				else if (m_iterator->left != nullptr) {
+					m_iterator = m_iterator->left;
+					while (m_iterator->right != nullptr) {
+						m_iterator = m_iterator->right;
+					}
+				}
+				else {
+					const Node* parent = m_iterator->parent;
+					while (parent != nullptr && m_iterator == parent->left) {
+						m_iterator = parent;
+						parent = parent->parent;
+					}
+					m_iterator = parent;
+				}
+				return *this;
+			}
+			constexpr InOrderIterator operator--(int) noexcept {
+				InOrderIterator tmp(*this);
+				--(*this);
+				return tmp;
+			}
+			constexpr friend bool operator==(const InOrderIterator& first, const InOrderIterator& second) noexcept {
+				return (first.m_iterator == second.m_iterator);
+			}
+			constexpr friend bool operator!=(const InOrderIterator& first, const InOrderIterator& second) noexcept {
+				return !(first.m_iterator == second.m_iterator);
+			}
+		};
+
+	public:
+		// The keys are immutable through iterators, so iterator and const_iterator are the same
+		// type - same choice std::set makes
+		using iterator = InOrderIterator;
+		using const_iterator = InOrderIterator;
+
+		constexpr iterator begin() const noexcept {
+			const Node* current = m_root;
+			while (current != nullptr && current->left != nullptr) {
+				current = current->left;
+			}
+			return iterator(current, this);
+		}
+
+		constexpr iterator end() const noexcept {
+			return iterator(nullptr, this);
+		}
+
+		constexpr const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		constexpr const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// First element not less than `key`: iterative O(log n) descent remembering the last node
+		// we went left from. Together with upper_bound() this turns a range query into
+		// for (auto it = tree.lower_bound(lo); it != tree.upper_bound(hi); ++it) ...
+		constexpr iterator lower_bound(const Key& key) const noexcept {
+			const Node* candidate = nullptr;
+			const Node* current = m_root;
+			while (current != nullptr) {
+				if (current->data < key) {
+					current = current->right;
+				}
+				else {
+					candidate = current;
+					current = current->left;
+				}
+			}
+			return iterator(candidate, this);
+		}
+
+		// First element greater than `key`
+		constexpr iterator upper_bound(const Key& key) const noexcept {
+			const Node* candidate = nullptr;
+			const Node* current = m_root;
+			while (current != nullptr) {
+				if (key < current->data) {
+					candidate = current;
+					current = current->left;
+				}
+				else {
+					current = current->right;
+				}
+			}
+			return iterator(candidate, this);
 		}
 
 	public:
@@ -141,39 +361,69 @@ namespace container {
 		}
 
 	public:
+		using allocator_type = Allocator;
+		using const_alloc_reference = const allocator_type&;
+
 		// Constructors, destructor, assignment/copy assignment
 		constexpr AVL() noexcept = default;
 
-		constexpr explicit AVL(std::initializer_list<Key> list)
-			: m_size{ list.size() }
+		constexpr explicit AVL(const_alloc_reference allocator) noexcept
+			: m_allocator{ allocator }
+		{}
+
+		constexpr explicit AVL(std::initializer_list<Key> list, const_alloc_reference allocator = Allocator())
+			: m_allocator{ allocator }
 		{
 			for (auto current : list) {
-				insert(m_root, current);
+				if (insert(m_root, nullptr, current))
+					++m_size;
 			}
 		}
 
 		template<typename input_iter>
-		constexpr AVL(input_iter first, input_iter last) {
+		constexpr AVL(input_iter first, input_iter last, const_alloc_reference allocator = Allocator())
+			: m_allocator{ allocator } {
 			for (auto& first_elem = first; first_elem < last; ++first_elem) {
-				insert(m_root, *first_elem);
-				++m_size;
+				if (insert(m_root, nullptr, *first_elem))
+					++m_size;
 			}
 		}
 
+		/* Bulk construction from an already sorted, duplicate-free range: O(n) with no rotations,
+		versus n O(log n) inserts. This is the way to (re)build a large index - see build_sorted()
+		for how the shape comes out perfectly balanced. The range being sorted is the caller's
+		responsibility. */
+		template<typename input_iter>
+		static constexpr AVL from_sorted(input_iter first, input_iter last, const_alloc_reference allocator = Allocator()) {
+			AVL tree(allocator);
+			tree.m_size = static_cast<size_type>(std::distance(first, last));
+			tree.m_root = tree.build_sorted(first, tree.m_size);
+			return tree;
+		}
+
+		constexpr allocator_type get_allocator() const noexcept {
+			return allocator_type(m_allocator);
+		}
+
 	private:
 		constexpr void deep_copy(Node* other, Node*& current) {
 			if (other == nullptr) { current = nullptr; }
 			else {
-				current = new Node();
+				current = create_node();
 				current->data = other->data;
+				current->balance_factor = other->balance_factor;
+				current->height = other->height;
 				deep_copy(other->left, current->left);
+				if (current->left != nullptr) current->left->parent = current;
 				deep_copy(other->right, current->right);
+				if (current->right != nullptr) current->right->parent = current;
 			}
 		}
 
 	public:
 		constexpr AVL(const AVL& other)
 			: m_size{ other.m_size }
+			, m_allocator{ node_alloc_traits::select_on_container_copy_construction(other.m_allocator) }
 		{
 			deep_copy(other.m_root, m_root);
 		}
@@ -190,6 +440,7 @@ namespace container {
 			other.m_root = temp_root;
 			temp_root = nullptr;
 			std::swap(m_size, other.m_size);
+			std::swap(m_allocator, other.m_allocator);
 		}
 
 	private:
@@ -198,7 +449,7 @@ namespace container {
 			{
 				destroy(current->left);
 				destroy(current->right);
-				delete current;
+				destroy_node(current);
 				current = nullptr;
 			}
 		}
@@ -236,30 +487,38 @@ namespace container {
 			return m_size;
 		}
 
+		// Tree height in edges (-1 when empty); pairs with stats() when watching balance behavior
+		constexpr int height() const noexcept {
+			return m_root != nullptr ? m_root->height : -1;
+		}
+
+		// Slow-path counters, populated only under CONTAINER_INSTRUMENTATION (empty struct otherwise)
+		constexpr const avl_stats& stats() const noexcept {
+			return m_stats;
+		}
+
 		constexpr void clear() noexcept {
 			destroy(m_root);
 			m_root = nullptr;
 			m_size = 0;
 		}
 
-		// Just to have a STL-like insert function. This just calls the previously-implemented insert function. 
+		// Just to have a STL-like insert function. This just calls the previously-implemented insert function.
 		constexpr void insert(const Key& value) {
-			insert(m_root, value);
-			++m_size;
+			if (insert(m_root, nullptr, value))
+				++m_size;
 		}
 
 		template<typename input_iterator>
 		constexpr void insert(input_iterator first, input_iterator last) {
 			for (auto& first_elem = first; first_elem < last; ++first_elem) {
-				insert(m_root, *first_elem);
-				++m_size;
+				insert(*first_elem);
 			}
 		}
 
 		constexpr void insert(std::initializer_list<Key> list) {
 			for (auto current : list) {
-				insert(m_root, current);
-				++m_size;
+				insert(current);
 			}
 		}
 
@@ -274,55 +533,70 @@ namespace container {
 			return curr;
 		}
 
-		// Removes specific node from the container based off the passed value
-		constexpr void remove(Node*& current, const Key& data) {
-			if (current == nullptr) return;
-			// 3 main cases in deletion: Node has no children, node has one child, or node has two children.
-			if (current->data == data) {
-				// Case 1: No children. We can simply delete the node and make it nullptr.
-				if (current->left == nullptr && current->right == nullptr) {
-					delete current;
-					current = nullptr;
+		/* Rebalancing after a deletion cannot reuse rebalance(): that one picks the rotation
+		direction by comparing against the inserted key, and after a removal the key is gone - the
+		direction has to come from the shape of the heavy child instead. (The old remove() fed the
+		removed key to rebalance() and could rotate through a null grandchild.) */
+		constexpr void rebalance_erase(Node*& current) noexcept {
+			const int balance = get_height(current->left) - get_height(current->right);
+			if (balance > 1) {
+				if (get_height(current->left->left) >= get_height(current->left->right)) {
+					rotate_right(current);
 				}
-				// Case 2: One children. We check which children the node got (Left or right?), delete the current node, and assign its only children Node to it (So no links are broken)
-				else if (current->left == nullptr && current->right != nullptr) {
-					Node* current_right = current->right;
-					delete current;
-					current = current_right;
-					current_right = nullptr;
+				else {
+					rotate_left(current->left);
+					rotate_right(current);
 				}
-				else if (current->right == nullptr && current->left != nullptr) {
-					Node* current_left = current->left;
-					delete current;
-					current = current_left;
-					current_left = nullptr;
+			}
+			else if (balance < -1) {
+				if (get_height(current->right->right) >= get_height(current->right->left)) {
+					rotate_left(current);
 				}
-				// Case 3: Two children. Two ways to proceed: Either take the largest element of the left-child, or the smallest element from the right-child. Then we just delete the current node
-				// And assign it the chosen child.
 				else {
-					// Get the node holding the min. value on the right side
-					Node* right_min = get_min(current->right);
-					// Assign that data to current
-					current->data = right_min->data;
-					// Delete the node we just assigned to current through a recursive call. Since the node we're deleting is the last one,
-					// the deletion will happen in one of the above if cases.
-					remove(current->right, right_min->data);
+					rotate_right(current->right);
+					rotate_left(current);
 				}
-				--m_size;
 			}
+		}
 
-			else if (data < current->data) {
-				remove(current->left, data);
+		// Removes the node holding `data` and rebalances on the way back up; O(log n) total.
+		// Returns whether the key was found.
+		constexpr bool erase_node(Node*& current, Node* parent, const Key& data) {
+			if (current == nullptr) return false;
+			bool erased;
+			// 3 main cases in deletion: Node has no children, node has one child, or node has two children.
+			if (data < current->data) {
+				erased = erase_node(current->left, current, data);
 			}
 			else if (data > current->data) {
-				remove(current->right, data);
+				erased = erase_node(current->right, current, data);
+			}
+			else {
+				// Cases 1 and 2: at most one child. Delete the node and splice its (possibly null)
+				// child into its place, so no links are broken.
+				if (current->left == nullptr || current->right == nullptr) {
+					Node* child = current->left != nullptr ? current->left : current->right;
+					if (child != nullptr) child->parent = parent;
+					destroy_node(current);
+					current = child;
+				}
+				// Case 3: Two children. Replace the data with the smallest key of the right subtree
+				// and delete that node instead - it has at most one child, so the recursive call
+				// lands in the branch above.
+				else {
+					Node* right_min = get_min(current->right);
+					current->data = right_min->data;
+					erase_node(current->right, current, right_min->data);
+				}
+				erased = true;
 			}
-			else return;
 
-			if (current != nullptr) {
+			if (current != nullptr && erased) {
+				update_height(current);
 				current->balance_factor = get_height(current->left) - get_height(current->right);
-				rebalance(current, data);
+				rebalance_erase(current);
 			}
+			return erased;
 		}
 
 		constexpr bool find(Node* current, const Key& data) {
@@ -335,14 +609,28 @@ namespace container {
 		}
 
 	public:
+		// Removes the given key if present; returns whether anything was removed
+		constexpr bool erase(const Key& data) {
+			if (erase_node(m_root, nullptr, data)) {
+				--m_size;
+				return true;
+			}
+			return false;
+		}
+
 		constexpr void remove(const Key& data) {
-			remove(m_root, data);
+			erase(data);
 		}
 
 		constexpr bool contains(const Key& data) {
 			return find(m_root, data);
 		}
 	};
+
+	namespace pmr {
+		template <class Key>
+		using avl = container::AVL<Key, std::pmr::polymorphic_allocator<Key>>;
+	}
 }
 
 #endif
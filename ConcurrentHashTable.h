@@ -0,0 +1,257 @@
+#ifndef CONCURRENT_HASH_TABLE_IMPLEMENTATION
+#define CONCURRENT_HASH_TABLE_IMPLEMENTATION
+
+#include "HashTable.h"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+namespace container {
+	/* Thread-safe layer over container::HashTable for read-mostly multi-core workloads. The elements
+	   are spread across ShardCount independent HashTables, each guarded by its own std::shared_mutex:
+	   readers on different shards never touch the same lock (and readers on the same shard share it),
+	   so lookup throughput scales with cores instead of serializing on one table-wide mutex. The shard
+	   is picked from the HIGH bits of the hash - the inner table masks the LOW bits for its buckets,
+	   so both levels get independent bits and a bad low-entropy hash doesn't collapse the sharding.
+
+	   The per-key interface mirrors HashTable (insert/emplace/at/contains_key/remove_by_key/...),
+	   with one deliberate difference: at() returns the mapped value BY COPY, because a reference into
+	   a shard would escape its lock and race with any later writer. Whole-table scans go through
+	   for_each_shard(), which hands the callback one locked shard at a time. */
+	template<typename Key, typename Type, typename Hash = std::hash<Key>, std::size_t ShardCount = 16>
+	class ConcurrentHashTable {
+		static_assert(ShardCount != 0 && std::has_single_bit(ShardCount), "error: ShardCount must be a power of two");
+
+	public:
+		using key_type = Key;
+		using mapped_type = Type;
+		using value_type = std::pair<const Key, mapped_type>;
+		using size_type = std::size_t;
+		using hasher = Hash;
+		using shard_type = HashTable<Key, Type, Hash>;
+
+	private:
+		struct shard {
+			mutable std::shared_mutex mutex;
+			shard_type table;
+		};
+
+		Hash m_hash;
+		std::array<shard, ShardCount> m_shards;
+
+		// High bits select the shard (see the class comment). A single shard needs no hashing at
+		// all - and its shift of 64 would be undefined anyway.
+		shard& shard_for(const Key& key) noexcept {
+			if constexpr (ShardCount == 1) {
+				return m_shards[0];
+			}
+			else {
+				constexpr std::size_t shift = std::numeric_limits<std::size_t>::digits - std::bit_width(ShardCount - 1);
+				return m_shards[m_hash(key) >> shift];
+			}
+		}
+
+		const shard& shard_for(const Key& key) const noexcept {
+			if constexpr (ShardCount == 1) {
+				return m_shards[0];
+			}
+			else {
+				constexpr std::size_t shift = std::numeric_limits<std::size_t>::digits - std::bit_width(ShardCount - 1);
+				return m_shards[m_hash(key) >> shift];
+			}
+		}
+
+	public:
+		ConcurrentHashTable(const hasher& hash = Hash())
+			: m_hash{ hash } {
+			for (auto& current : m_shards) {
+				current.table = shard_type(hash);
+			}
+		}
+
+		explicit ConcurrentHashTable(std::initializer_list<value_type> list, const hasher& hash = Hash())
+			: ConcurrentHashTable(hash) {
+			for (const auto& current : list) {
+				insert(current);
+			}
+		}
+
+		// Not copyable or movable: std::shared_mutex is neither, and moving a table out from under
+		// concurrent users would be a race anyway
+		ConcurrentHashTable(const ConcurrentHashTable&) = delete;
+		ConcurrentHashTable& operator=(const ConcurrentHashTable&) = delete;
+
+		// Capacity related. size() takes every shard lock in turn, so the result is only a snapshot
+		// when writers are active - same as any concurrent container.
+		bool empty() const {
+			return size() == 0;
+		}
+
+		size_type size() const {
+			size_type total{ 0 };
+			for (const auto& current : m_shards) {
+				std::shared_lock lock{ current.mutex };
+				total += current.table.size();
+			}
+			return total;
+		}
+
+		static constexpr size_type shard_count() noexcept {
+			return ShardCount;
+		}
+
+		// Modifiers
+		void clear() {
+			for (auto& current : m_shards) {
+				std::unique_lock lock{ current.mutex };
+				current.table.clear();
+			}
+		}
+
+		bool insert(const value_type& value) {
+			shard& target{ shard_for(value.first) };
+			std::unique_lock lock{ target.mutex };
+			return target.table.insert(value);
+		}
+
+		bool insert(value_type&& value) {
+			shard& target{ shard_for(value.first) };
+			std::unique_lock lock{ target.mutex };
+			return target.table.insert(std::move(value));
+		}
+
+		void insert(std::initializer_list<value_type> list) {
+			for (const auto& elem : list) {
+				insert(elem);
+			}
+		}
+
+		template<typename...Args>
+		bool emplace(Args&&...args) {
+			// Built up front so the shard can be picked before any lock is taken
+			std::pair<Key, Type> value(std::forward<Args>(args)...);
+			shard& target{ shard_for(value.first) };
+			std::unique_lock lock{ target.mutex };
+			return target.table.emplace(std::move(value.first), std::move(value.second));
+		}
+
+		template<typename Val>
+		bool insert_or_assign(const Key& key, Val&& value) {
+			shard& target{ shard_for(key) };
+			std::unique_lock lock{ target.mutex };
+			return target.table.insert_or_assign(key, std::forward<Val>(value));
+		}
+
+		bool remove_by_key(const Key& key) {
+			shard& target{ shard_for(key) };
+			std::unique_lock lock{ target.mutex };
+			return target.table.remove_by_key(key);
+		}
+
+		// O(n) over every shard, exactly like the single-threaded version's value scan
+		bool remove_by_value(const Type& value) {
+			for (auto& current : m_shards) {
+				std::unique_lock lock{ current.mutex };
+				if (current.table.remove_by_value(value))
+					return true;
+			}
+			return false;
+		}
+
+		// Lookup functions. These take the shard lock in shared mode, so concurrent readers
+		// never block one another.
+		Type at(const Key& key) const {
+			const shard& target{ shard_for(key) };
+			std::shared_lock lock{ target.mutex };
+			return target.table.at(key);
+		}
+
+		size_type count(const Key& key) const {
+			const shard& target{ shard_for(key) };
+			std::shared_lock lock{ target.mutex };
+			return target.table.count(key);
+		}
+
+		bool contains_key(const Key& key) const {
+			return count(key) == 1;
+		}
+
+		bool contains_value(const Type& value) const {
+			for (const auto& current : m_shards) {
+				std::shared_lock lock{ current.mutex };
+				if (current.table.contains_value(value))
+					return true;
+			}
+			return false;
+		}
+
+		// Applies `func` to the mapped value while the shard lock is held - the safe way to read or
+		// modify in place without at()'s copy. Returns false when the key is absent.
+		template<typename Func>
+		bool visit(const Key& key, Func func) {
+			shard& target{ shard_for(key) };
+			std::unique_lock lock{ target.mutex };
+			auto found = target.table.find(key);
+			if (found == target.table.end())
+				return false;
+			func(found->second);
+			return true;
+		}
+
+		template<typename Func>
+		bool visit(const Key& key, Func func) const {
+			const shard& target{ shard_for(key) };
+			std::shared_lock lock{ target.mutex };
+			auto found = target.table.find(key);
+			if (found == target.table.end())
+				return false;
+			func(found->second);
+			return true;
+		}
+
+		// Bulk scans: hands the callback each underlying HashTable in turn, holding that shard's lock
+		// for the duration of the call. N threads can each take a disjoint range of shard indices via
+		// the overloads taking first/last, which is how a parallel scan avoids contending at all.
+		template<typename Func>
+		void for_each_shard(Func func) {
+			for_each_shard(0, ShardCount, func);
+		}
+
+		template<typename Func>
+		void for_each_shard(Func func) const {
+			for_each_shard(0, ShardCount, func);
+		}
+
+		template<typename Func>
+		void for_each_shard(size_type first, size_type last, Func func) {
+			for (size_type index{ first }; index < last && index < ShardCount; ++index) {
+				std::unique_lock lock{ m_shards[index].mutex };
+				func(m_shards[index].table);
+			}
+		}
+
+		template<typename Func>
+		void for_each_shard(size_type first, size_type last, Func func) const {
+			for (size_type index{ first }; index < last && index < ShardCount; ++index) {
+				std::shared_lock lock{ m_shards[index].mutex };
+				func(m_shards[index].table);
+			}
+		}
+
+		// Hash related: the count is split evenly across shards
+		void reserve(size_type count) {
+			for (auto& current : m_shards) {
+				std::unique_lock lock{ current.mutex };
+				current.table.reserve(count / ShardCount + 1);
+			}
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,316 @@
+#ifndef FLAT_HASH_TABLE_IMPLEMENTATION
+#define FLAT_HASH_TABLE_IMPLEMENTATION
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace container {
+	/* Open-addressing alternative to container::HashTable: instead of a vector of linked lists,
+	   every entry lives directly in one flat slot array and collisions are resolved by linear
+	   probing. A separate contiguous state array (empty/occupied/tombstone, one byte per slot) is
+	   what the probe loop actually scans, so a lookup touches the payload only for real candidates.
+	   No per-node allocations, no pointer chasing - a miss costs a short scan of adjacent bytes.
+	   The public interface mirrors container::HashTable. */
+	template<typename Key, typename Type, typename Hash = std::hash<Key>>
+	class FlatHashTable {
+	public:
+		using key_type = Key;
+		using mapped_type = Type;
+		using value_type = std::pair<Key, Type>;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using hasher = Hash;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = value_type*;
+		using const_pointer = const pointer;
+
+	private:
+		enum class slot_state : unsigned char { empty, occupied, tombstone };
+
+		inline static const double grow_factor = 2.0;
+		inline static const double m_max_load_factor = 0.75;	// Probing degrades sharply above this, unlike the chained table's 1.0
+		inline static const size_type initial_buckets = 16;
+
+		std::size_t m_size{};					// Occupied slots (tombstones excluded)
+		std::size_t m_used{};					// Occupied + tombstoned slots - this is what drives rehashing
+		Hash m_hash;
+		std::size_t m_bucket_count{};			// Always a power of two, so indexing can mask instead of dividing
+		std::vector<slot_state> m_states;
+		std::vector<std::optional<value_type>> m_slots;
+		std::vector<std::size_t> m_hashes;		// Full hash of each occupied slot: key comparisons are skipped
+								// unless the hashes match, and rehash() never re-hashes a key
+
+		// Walks the probe sequence of `key` (whose hash the caller already computed). Returns the
+		// index holding the key if present, otherwise the first slot where it could be inserted
+		// (first tombstone seen, else the empty slot that ended the scan).
+		constexpr size_type probe(const Key& key, std::size_t hash) const {
+			const size_type mask{ m_bucket_count - 1 };
+			size_type index{ hash & mask };
+			size_type first_tombstone{ m_bucket_count };	// m_bucket_count = none seen yet
+			while (true) {
+				if (m_states[index] == slot_state::empty) {
+					return first_tombstone != m_bucket_count ? first_tombstone : index;
+				}
+				if (m_states[index] == slot_state::tombstone) {
+					if (first_tombstone == m_bucket_count)
+						first_tombstone = index;
+				}
+				else if (m_hashes[index] == hash && m_slots[index]->first == key) {
+					return index;
+				}
+				index = (index + 1) & mask;
+			}
+		}
+
+		constexpr double calculate_load_factor() const noexcept {
+			return m_bucket_count == 0 ? 1.0 : static_cast<double>(m_used) / m_bucket_count;
+		}
+
+		constexpr void grow_if_needed() {
+			if (m_bucket_count == 0) {
+				rehash(initial_buckets);
+			}
+			else if (calculate_load_factor() > m_max_load_factor) {
+				rehash(static_cast<size_type>(m_bucket_count * grow_factor));
+			}
+		}
+
+	public:
+		// Default constructor
+		constexpr FlatHashTable(const hasher& hash = Hash())
+			: m_size{ 0 }
+			, m_hash{ hash }
+			, m_bucket_count{ 0 }
+		{}
+
+		constexpr explicit FlatHashTable(std::initializer_list<value_type> list, const hasher& hash = Hash())
+			: m_hash{ hash } {
+			rehash(static_cast<size_type>(list.size() * grow_factor) + 1);
+			for (const auto& current : list) {
+				insert(current);
+			}
+		}
+
+		// The implicit copy/move members are correct here: all storage is owned by the vectors.
+
+		constexpr FlatHashTable& operator=(std::initializer_list<value_type> list) {
+			FlatHashTable temp{ list };
+			temp.swap(*this);
+			return *this;
+		}
+
+		// Capacity related
+		constexpr bool empty() const noexcept {
+			return m_size == 0;
+		}
+
+		constexpr size_type size() const noexcept {
+			return m_size;
+		}
+
+		constexpr size_type bucket_count() const noexcept {
+			return m_bucket_count;
+		}
+
+		// Modifiers
+		constexpr void clear() noexcept {
+			m_states.clear();
+			m_slots.clear();
+			m_hashes.clear();
+			m_size = 0;
+			m_used = 0;
+			m_bucket_count = 0;
+		}
+
+		// Average O(1); O(n) when the insertion triggers a rehash
+		constexpr bool insert(const value_type& value) {
+			return emplace(value);
+		}
+
+		constexpr bool insert(value_type&& value) {
+			return emplace(std::move(value));
+		}
+
+		constexpr void insert(std::initializer_list<value_type> list) {
+			for (const auto& elem : list) {
+				insert(elem);
+			}
+		}
+
+		template<typename...Args>
+		constexpr bool emplace(Args&&...args) {
+			grow_if_needed();
+			value_type value(std::forward<Args>(args)...);
+			const std::size_t hash = m_hash(value.first);
+			const size_type index = probe(value.first, hash);
+			if (m_states[index] == slot_state::occupied) return false;
+			if (m_states[index] == slot_state::empty) ++m_used;
+			m_slots[index].emplace(std::move(value));
+			m_states[index] = slot_state::occupied;
+			m_hashes[index] = hash;
+			++m_size;
+			return true;
+		}
+
+		template<typename Val>
+		constexpr bool insert_or_assign(const Key& key, Val&& value) {
+			grow_if_needed();
+			const std::size_t hash = m_hash(key);
+			const size_type index = probe(key, hash);
+			if (m_states[index] == slot_state::occupied) {
+				m_slots[index]->second = std::forward<Val>(value);
+				return false;
+			}
+			if (m_states[index] == slot_state::empty) ++m_used;
+			m_slots[index].emplace(key, std::forward<Val>(value));
+			m_states[index] = slot_state::occupied;
+			m_hashes[index] = hash;
+			++m_size;
+			return true;
+		}
+
+		// O(1) average: the slot is just tombstoned, no shifting and no deallocation
+		constexpr bool remove_by_key(const Key& key) {
+			if (m_bucket_count == 0) return false;
+			const size_type index = probe(key, m_hash(key));
+			if (m_states[index] != slot_state::occupied) return false;
+			m_slots[index].reset();
+			m_states[index] = slot_state::tombstone;
+			--m_size;
+			return true;
+		}
+
+		// O(n): value lookups have no index to help them, same as the chained table
+		constexpr bool remove_by_value(const Type& value) {
+			for (size_type index{ 0 }; index < m_bucket_count; ++index) {
+				if (m_states[index] == slot_state::occupied && m_slots[index]->second == value) {
+					m_slots[index].reset();
+					m_states[index] = slot_state::tombstone;
+					--m_size;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Lookup functions
+		constexpr Type& at(const Key& key) {
+			if (m_bucket_count != 0) {
+				const size_type index = probe(key, m_hash(key));
+				if (m_states[index] == slot_state::occupied)
+					return m_slots[index]->second;
+			}
+			throw std::out_of_range("Specified key is not associated with any element");
+		}
+
+		constexpr const Type& at(const Key& key) const {
+			if (m_bucket_count != 0) {
+				const size_type index = probe(key, m_hash(key));
+				if (m_states[index] == slot_state::occupied)
+					return m_slots[index]->second;
+			}
+			throw std::out_of_range("Specified key is not associated with any element");
+		}
+
+		// Inserts a default-constructed mapped value when the key is absent, like std::unordered_map
+		constexpr Type& operator[](const Key& key) {
+			grow_if_needed();
+			const std::size_t hash = m_hash(key);
+			const size_type index = probe(key, hash);
+			if (m_states[index] == slot_state::occupied)
+				return m_slots[index]->second;
+			if (m_states[index] == slot_state::empty) ++m_used;
+			m_slots[index].emplace(key, Type());
+			m_states[index] = slot_state::occupied;
+			m_hashes[index] = hash;
+			++m_size;
+			return m_slots[index]->second;
+		}
+
+		constexpr size_type count(const Key& key) const {
+			if (m_bucket_count == 0) return 0;
+			return m_states[probe(key, m_hash(key))] == slot_state::occupied ? 1 : 0;
+		}
+
+		constexpr bool contains_key(const Key& key) const {
+			return count(key) == 1;
+		}
+
+		constexpr bool contains_value(const Type& value) const {
+			for (size_type index{ 0 }; index < m_bucket_count; ++index) {
+				if (m_states[index] == slot_state::occupied && m_slots[index]->second == value)
+					return true;
+			}
+			return false;
+		}
+
+		// Hash related
+		constexpr double load_factor() const noexcept {
+			return calculate_load_factor();
+		}
+
+		constexpr double max_load_factor() const noexcept {
+			return m_max_load_factor;
+		}
+
+		constexpr void reserve(size_type count) {
+			const size_type needed = static_cast<size_type>(count / m_max_load_factor) + 1;
+			if (needed > m_bucket_count)
+				rehash(needed);
+		}
+
+		// O(n). Also the only operation that reclaims tombstones. The keys are never re-hashed:
+		// every occupied slot already carries its full hash, so the loop below just masks the cached
+		// value against the new bucket count and probes for an empty slot - no duplicate checks
+		// either, since the keys were already unique in the old table. For expensive-to-hash keys
+		// (strings in particular) this is where the cached hashes pay for their storage.
+		constexpr void rehash(size_type n) {
+			if (n < m_size) n = m_size + 1;
+			n = std::bit_ceil(n);
+			std::vector<slot_state> old_states(n, slot_state::empty);
+			std::vector<std::optional<value_type>> old_slots(n);
+			std::vector<std::size_t> old_hashes(n);
+			old_states.swap(m_states);
+			old_slots.swap(m_slots);
+			old_hashes.swap(m_hashes);
+			const size_type old_bucket_count = m_bucket_count;
+			const size_type mask{ n - 1 };
+			m_bucket_count = n;
+			for (size_type index{ 0 }; index < old_bucket_count; ++index) {
+				if (old_states[index] != slot_state::occupied)
+					continue;
+				size_type slot{ old_hashes[index] & mask };
+				while (m_states[slot] == slot_state::occupied)
+					slot = (slot + 1) & mask;
+				m_slots[slot] = std::move(old_slots[index]);
+				m_states[slot] = slot_state::occupied;
+				m_hashes[slot] = old_hashes[index];
+			}
+			m_used = m_size;	// No tombstones survive a rehash
+		}
+
+		constexpr void rehash() {
+			rehash(static_cast<size_type>(m_bucket_count * grow_factor));
+		}
+
+		constexpr void swap(FlatHashTable& other) noexcept {
+			std::swap(m_size, other.m_size);
+			std::swap(m_used, other.m_used);
+			std::swap(m_bucket_count, other.m_bucket_count);
+			std::swap(m_hash, other.m_hash);
+			std::swap(m_states, other.m_states);
+			std::swap(m_slots, other.m_slots);
+			std::swap(m_hashes, other.m_hashes);
+		}
+	};
+}
+
+#endif
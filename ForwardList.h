@@ -9,24 +9,152 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+
+#include "container_stats.h"
 #include <type_traits>
 #include <utility>
 
 namespace container {
-	template<typename Type>
+	template<typename Type, typename Allocator = std::allocator<Type>>
 	class ForwardList {
 	private:
 		struct Node {
 			Type data;
 			Node* next;
+			bool pooled = false;	// Lives inside a Block: never handed back to the allocator alone
 			Node() = default;
 			template<class... Args>
 			constexpr explicit Node(Args&&... args) : data{ std::forward<Args>(args)... } {}
 		};
 
-		Node* m_head;
-		Node* m_tail;
+		/* Bulk-construction backing store: when the final node count is known up front (sized
+		ranges, count constructors, copies) the nodes are carved out of contiguous blocks like
+		these, one allocation per block_size nodes instead of one per node - and a freshly built
+		list is sequential in memory, which every later traversal feels. The block keeps ownership
+		of the storage; its nodes are flagged pooled and recycled through the freelist like any
+		other, but only the whole block is ever deallocated. */
+		static constexpr std::size_t block_size = 256;
+
+		struct Block {
+			Block* next = nullptr;
+			alignas(Node) std::byte storage[block_size * sizeof(Node)];
+
+			Node* node(std::size_t index) noexcept {
+				return reinterpret_cast<Node*>(storage) + index;
+			}
+		};
+
+		// The user hands us an allocator for Type, but what we actually allocate are Nodes: rebind it
+		// and route every node through allocator_traits, like vector does for its buffer. With e.g a
+		// std::pmr::monotonic_buffer_resource this removes the per-node malloc/free entirely.
+		using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+		using node_alloc_traits = std::allocator_traits<node_allocator>;
+		using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+		using block_alloc_traits = std::allocator_traits<block_allocator>;
+
+		Node* m_head = nullptr;
+		Node* m_tail = nullptr;
 		std::size_t m_size{};
+		Node* m_free = nullptr;		// Recycled nodes, chained through their next pointers
+		Block* m_blocks = nullptr;	// Bulk-allocated node blocks this list owns
+		[[no_unique_address]] list_stats m_stats;	// Empty unless CONTAINER_INSTRUMENTATION (see container_stats.h)
+		node_allocator m_allocator;
+
+		/* Builds `count` linked nodes out of contiguous blocks; `make` yields each payload in
+		order. Only called on an empty list by the sized constructors. */
+		template<typename Maker>
+		constexpr void build_n(std::size_t count, Maker make) {
+			block_allocator block_alloc(m_allocator);
+			Node* prev = nullptr;
+			std::size_t built = 0;
+			while (built < count) {
+				Block* block = block_alloc_traits::allocate(block_alloc, 1);
+				block->next = m_blocks;
+				m_blocks = block;
+				CONTAINER_STATS(++m_stats.blocks_allocated);
+				const std::size_t in_block = std::min(block_size, count - built);
+				CONTAINER_STATS(m_stats.nodes_allocated += in_block);
+				for (std::size_t index = 0; index < in_block; ++index) {
+					Node* node = block->node(index);
+					std::construct_at(node, make());
+					node->pooled = true;
+					if (prev != nullptr) { prev->next = node; }
+					else { m_head = node; }
+					prev = node;
+				}
+				built += in_block;
+			}
+			m_tail = prev;
+			m_tail->next = nullptr;
+		}
+
+		// Appends `other`'s node blocks to ours: whenever nodes migrate between lists wholesale
+		// (splice/merge) the storage that backs them has to follow
+		constexpr void adopt_blocks(ForwardList& other) noexcept {
+			other.trim();	// Its pooled free nodes point into the blocks changing hands
+			if (other.m_blocks == nullptr) { return; }
+			Block* last = other.m_blocks;
+			while (last->next != nullptr) {
+				last = last->next;
+			}
+			last->next = m_blocks;
+			m_blocks = other.m_blocks;
+			other.m_blocks = nullptr;
+		}
+
+		constexpr void release_blocks() noexcept {
+			block_allocator block_alloc(m_allocator);
+			while (m_blocks != nullptr) {
+				Block* next = m_blocks->next;
+				block_alloc_traits::deallocate(block_alloc, m_blocks, 1);
+				m_blocks = next;
+			}
+		}
+
+		/* Erased nodes are not handed back to the allocator: destroy_node() keeps the storage on an
+		internal freelist and create_node() reuses it before allocating anything new. Under steady
+		insert/erase churn (an LRU is the typical case) the allocator drops out of the loop entirely,
+		and since the freelist is LIFO the most recently freed - still cache-warm - node is reused
+		first. trim() gives the pool back. */
+		template<typename...Args>
+		constexpr Node* create_node(Args&&...args) {
+			if (m_free != nullptr) {
+				Node* node = m_free;
+				m_free = node->next;
+				CONTAINER_STATS(++m_stats.nodes_reused);
+				// Only the payload was destroyed when the node was recycled
+				std::construct_at(std::addressof(node->data), std::forward<Args>(args)...);
+				return node;
+			}
+			CONTAINER_STATS(++m_stats.nodes_allocated);
+			Node* node = node_alloc_traits::allocate(m_allocator, 1);
+			node_alloc_traits::construct(m_allocator, node, std::forward<Args>(args)...);
+			return node;
+		}
+
+		constexpr void destroy_node(Node* node) noexcept {
+			CONTAINER_STATS(++m_stats.nodes_freed);
+			std::destroy_at(std::addressof(node->data));
+			node->next = m_free;
+			m_free = node;
+		}
+
+	public:
+		// Returns the recycled nodes to the allocator. The payloads are long dead, so this is
+		// deallocation only - worth calling after a large shrink that won't be refilled. Pooled
+		// nodes just drop off the list: their storage belongs to a Block, freed only wholesale.
+		constexpr void trim() noexcept {
+			while (m_free != nullptr) {
+				Node* next = m_free->next;
+				if (!m_free->pooled) {
+					node_alloc_traits::deallocate(m_allocator, m_free, 1);
+				}
+				m_free = next;
+			}
+		}
+
+	private:
 
 		/* Forward iterator */
 		template<typename T>
@@ -66,7 +194,7 @@ namespace container {
 			Node* current_node = other.m_head;
 			while (current_node != nullptr) {
 				Node* next_node = current_node->next;
-				delete current_node;
+				other.destroy_node(current_node);	// other's allocator owns these nodes
 				current_node = next_node;
 			}
 			other.m_head = nullptr;
@@ -84,6 +212,8 @@ namespace container {
 		using const_pointer = const pointer;
 		using iterator = forward_iterator<value_type>;
 		using const_iterator = forward_iterator<const Type>;
+		using allocator_type = Allocator;
+		using const_alloc_reference = const allocator_type&;
 
 		// Member functions
 		constexpr ForwardList() noexcept
@@ -92,54 +222,40 @@ namespace container {
 			, m_size{ 0 }
 		{}
 
-		constexpr explicit ForwardList(size_type count, const_reference value)
-			: m_size{ count } {
+		constexpr explicit ForwardList(const_alloc_reference allocator) noexcept
+			: m_allocator{ allocator }
+		{}
+
+		constexpr explicit ForwardList(size_type count, const_reference value, const_alloc_reference allocator = Allocator())
+			: m_size{ count }
+			, m_allocator{ allocator } {
 			assert(count != 0 && "count is 0");
-			Node* current_node = new Node(value);
-			m_head = current_node;
-			for (size_type index{ 0 }; index < count - 1; ++index) {
-				current_node->next = new Node(value);
-				current_node = current_node->next;
-			}
-			m_tail = current_node;
-			m_tail->next = nullptr;
+			build_n(count, [&value]() -> const_reference { return value; });
 		}
 
-		// Type must be DefaultConstructible 
-		constexpr explicit ForwardList(size_type count)
-			: ForwardList(count, Type{})
+		// Type must be DefaultConstructible
+		constexpr explicit ForwardList(size_type count, const_alloc_reference allocator = Allocator())
+			: ForwardList(count, Type{}, allocator)
 		{}
 
 		template<std::input_iterator input_iter>
-		constexpr ForwardList(input_iter first, input_iter last)
-			: m_size{ static_cast<size_type>(std::distance(first, last)) } {
+		constexpr ForwardList(input_iter first, input_iter last, const_alloc_reference allocator = Allocator())
+			: m_size{ static_cast<size_type>(std::distance(first, last)) }
+			, m_allocator{ allocator } {
 			assert(first != last && "First == last");
-			Node* current_node = new Node(*first);
-			m_head = current_node;
-			for (size_type index{ 0 }; index < m_size - 1; ++index) {
-				current_node->next = new Node(*(++first));
-				current_node = current_node->next;
-			}
-			m_tail = current_node;
-			m_tail->next = nullptr;
+			build_n(m_size, [&first]() -> decltype(auto) { return *first++; });
 		}
 
-		constexpr ForwardList(const ForwardList& other) {
+		constexpr ForwardList(const ForwardList& other)
+			: m_allocator{ node_alloc_traits::select_on_container_copy_construction(other.m_allocator) } {
 			if (other.m_head) {
 				m_size = other.m_size;
-				Node* current_node = new Node(other.m_head->data);
 				Node* current_other_node = other.m_head;
-				m_head = current_node;
-				while (current_other_node->next != nullptr) {
-					current_node->next = new Node(current_other_node->next->data);
-					current_node = current_node->next;
+				build_n(m_size, [&current_other_node]() -> const_reference {
+					const_reference data = current_other_node->data;
 					current_other_node = current_other_node->next;
-				}
-				m_tail = current_node;
-				m_tail->next = nullptr;
-			}
-			else {
-				ForwardList();
+					return data;
+				});
 			}
 		}
 
@@ -148,18 +264,29 @@ namespace container {
 			other.swap(*this);
 		}
 
-		constexpr ForwardList(std::initializer_list<Type> list) // Use the iterator constructor and std::begin/std::end
-			: ForwardList(std::begin(list), std::end(list))
+		constexpr ForwardList(std::initializer_list<Type> list, const_alloc_reference allocator = Allocator()) // Use the iterator constructor and std::begin/std::end
+			: ForwardList(std::begin(list), std::end(list), allocator)
 		{}
 
 		~ForwardList() {
 			Node* current_node = m_head;
 			while (current_node != nullptr) {
 				Node* next_node = current_node->next;
-				delete current_node;
+				destroy_node(current_node);
 				current_node = next_node;
 			}
 			m_head = nullptr;
+			trim();		// Everything above only moved the nodes onto the freelist
+			release_blocks();
+		}
+
+		// Node traffic counters, populated only under CONTAINER_INSTRUMENTATION (empty struct otherwise)
+		constexpr const list_stats& stats() const noexcept {
+			return m_stats;
+		}
+
+		constexpr allocator_type get_allocator() const noexcept {
+			return allocator_type(m_allocator);
 		}
 
 		constexpr ForwardList& operator=(const ForwardList& other) {
@@ -256,7 +383,7 @@ namespace container {
 		template<typename...Args>
 		constexpr iterator emplace_after(const iterator position, Args...args) { // Must be O(1)
 			Node* temp = position.getNodeAddress();
-			Node* current_node = new Node(std::forward<Args>(args)...);
+			Node* current_node = create_node(std::forward<Args>(args)...);
 			if (temp == m_tail) {
 				m_tail->next = current_node;
 				current_node->next = nullptr;
@@ -300,13 +427,13 @@ namespace container {
 			Node* temp = position.getNodeAddress();
 			Node* next_temp = temp->next;
 			if (temp != nullptr && next_temp->next == nullptr) {
-				delete temp->next;
+				destroy_node(temp->next);
 				temp->next = nullptr;
 				m_size -= 1;
 			}
 			else if (temp != nullptr) {
 				temp->next = next_temp->next;
-				delete next_temp;
+				destroy_node(next_temp);
 				m_size -= 1;
 			}
 			auto pos = position;
@@ -320,7 +447,7 @@ namespace container {
 
 			while (firstNode_next != lastNode_temp) {
 				Node* temp = firstNode_next->next;
-				delete firstNode_next;
+				destroy_node(firstNode_next);
 				firstNode_next = temp;
 				--m_size;
 			}
@@ -340,9 +467,10 @@ namespace container {
 		template<typename...Args>
 		constexpr reference emplace_front(Args...args) {
 			Node* head_temp = m_head;
-			Node* current = new Node(std::forward<Args>(args)...);
+			Node* current = create_node(std::forward<Args>(args)...);
 			m_head = current;
 			m_head->next = head_temp;
+			if (m_tail == nullptr) { m_tail = m_head; }	// First node is head and tail at once
 			++m_size;
 			return m_head->data;
 		}
@@ -351,13 +479,14 @@ namespace container {
 			Node* head_temp = m_head;
 			Node* next_temp = m_head->next;
 			m_head = next_temp;
-			delete head_temp;
+			if (m_head == nullptr) { m_tail = nullptr; }	// Popped the only node
+			destroy_node(head_temp);
 			--m_size;
 		}
 
 		constexpr void resize(size_type count, const_reference value = Type()) {
 			if (count < size()) {
-				if (count == 0) { deallocate(); }
+				if (count == 0) { deallocate(*this); }
 				else {
 					Node* tmp = m_head;
 					for (size_type index{ 0 }; index < count - 1; ++index) {
@@ -367,10 +496,10 @@ namespace container {
 					tmp = tmp->next;
 					while (tmp->next != m_tail) {
 						Node* tmpp = tmp->next;
-						delete tmp;
+						destroy_node(tmp);
 						tmp = tmpp;
 					}
-					delete m_tail;
+					destroy_node(m_tail);
 					m_tail = other_tmp;
 					m_tail->next = nullptr;
 				}
@@ -379,7 +508,7 @@ namespace container {
 			else {
 				Node* temp_tail = m_tail;
 				for (size_type index{ 0 }; index < count; ++index) {
-					temp_tail->next = new Node(value);
+					temp_tail->next = create_node(value);
 					temp_tail = temp_tail->next;
 				}
 				m_tail = temp_tail;
@@ -403,6 +532,9 @@ namespace container {
 			temp_tail = nullptr;
 
 			std::swap(m_size, other.m_size);
+			std::swap(m_free, other.m_free);	// The pools follow their allocators
+			std::swap(m_blocks, other.m_blocks);
+			std::swap(m_allocator, other.m_allocator);
 		}
 
 		constexpr void splice_after(const iterator position, ForwardList& other) {
@@ -424,6 +556,7 @@ namespace container {
 			other.m_size = 0;
 			other.m_head = nullptr;
 			other.m_tail = nullptr;
+			adopt_blocks(other);
 		}
 
 	private:
@@ -432,7 +565,7 @@ namespace container {
 			const auto removed_next = to_remove->next;
 			beforeNode->next = removed_next;
 
-			delete to_remove;
+			destroy_node(to_remove);
 			return removed_next;
 		}
 
@@ -443,7 +576,7 @@ namespace container {
 
 		template<typename Predicate>
 		constexpr size_type remove_if(Predicate pred) {
-			Node* before_begin = new Node();
+			Node* before_begin = create_node();
 			Node* tmp_before_begin = before_begin;
 			before_begin->next = m_head;
 			size_type tot_removed{ 0 };
@@ -465,6 +598,7 @@ namespace container {
 				}
 			}
 
+			destroy_node(tmp_before_begin);	// The dummy head node; this used to leak
 			m_size -= tot_removed;
 			return tot_removed;
 		}
@@ -495,33 +629,90 @@ namespace container {
 		}
 
 	private:
-		/*Example taken from geeksforgeeks*/
-		constexpr void _Sort(Node* (&head_ref), Node* new_node) {
-			Node* current;
-			if (head_ref == nullptr || (head_ref)->data >= new_node->data) {
-				new_node->next = head_ref;
-				head_ref = new_node;
-			}
-			else {
-				current = head_ref;
-				while (current->next != nullptr && current->next->data < new_node->data) {
-					current = current->next;
+		/* Merges two sorted node chains in place by relinking next pointers - the data itself never
+		moves. Ties take from `first`, which is what keeps the sort stable. Returns the merged head;
+		the callers re-derive the tail. */
+		constexpr Node* merge_nodes(Node* first, Node* second) noexcept {
+			Node* head;
+			if (second->data < first->data) { head = second; second = second->next; }
+			else { head = first; first = first->next; }
+			Node* tail = head;
+			while (first != nullptr && second != nullptr) {
+				if (second->data < first->data) {
+					tail->next = second;
+					second = second->next;
+				}
+				else {
+					tail->next = first;
+					first = first->next;
 				}
-				new_node->next = current->next;
-				current->next = new_node;
+				tail = tail->next;
 			}
+			tail->next = (first != nullptr) ? first : second;
+			return head;
 		}
 
 	public:
+		/* Bottom-up merge sort, the same scheme std::list uses: bins[i] holds a sorted run of 2^i
+		nodes, every incoming node cascades through the bins like a binary carry, and the surviving
+		runs are merged once at the end. O(n log n) comparisons and O(1) extra space, with nodes
+		relinked instead of copied. (The previous version was an insertion sort that rescanned the
+		sorted prefix for every node - O(n^2) - and forgot to update m_tail.) */
 		constexpr void sort() {
-			Node* sorted = nullptr;
+			if (m_size < 2) { return; }
+			Node* bins[64] = {};
+			int max_bin = 0;
 			Node* current = m_head;
 			while (current != nullptr) {
 				Node* next = current->next;
-				_Sort(sorted, current);
+				current->next = nullptr;
+				Node* carry = current;
+				int index = 0;
+				while (bins[index] != nullptr) {
+					carry = merge_nodes(bins[index], carry);
+					bins[index] = nullptr;
+					++index;
+				}
+				bins[index] = carry;
+				if (index > max_bin) { max_bin = index; }
 				current = next;
 			}
+
+			Node* sorted = nullptr;
+			for (int index = 0; index <= max_bin; ++index) {
+				if (bins[index] != nullptr) {
+					// bins[index] came earlier in the original list than everything merged so far,
+					// so it goes in as `first` to preserve stability
+					sorted = (sorted == nullptr) ? bins[index] : merge_nodes(bins[index], sorted);
+				}
+			}
 			m_head = sorted;
+			Node* tail = sorted;
+			while (tail->next != nullptr) {
+				tail = tail->next;
+			}
+			m_tail = tail;
+		}
+
+		// Steals the nodes of `other` into this list, keeping the order - both lists must already
+		// be sorted. The node-stealing counterpart of splice_after(): O(n + m) relinks, no copies.
+		constexpr void merge(ForwardList& other) {
+			if (this == &other || other.m_head == nullptr) { return; }
+			if (m_head == nullptr) {
+				m_head = other.m_head;
+				m_tail = other.m_tail;
+			}
+			else {
+				// On a tie the last node comes from `other` (merge_nodes prefers *this), so only a
+				// strictly greater own tail survives as the merged tail
+				m_tail = (other.m_tail->data < m_tail->data) ? m_tail : other.m_tail;
+				m_head = merge_nodes(m_head, other.m_head);
+			}
+			m_size += other.m_size;
+			other.m_head = nullptr;
+			other.m_tail = nullptr;
+			other.m_size = 0;
+			adopt_blocks(other);
 		}
 
 		constexpr bool operator<=(const ForwardList<Type>& other) {
@@ -562,6 +753,11 @@ namespace container {
 			return !(std::lexicographical_compare(begin(), end(), other.begin(), other.end()));
 		}
 	};
+
+	namespace pmr {
+		template <class T>
+		using forward_list = container::ForwardList<T, std::pmr::polymorphic_allocator<T>>;
+	}
 }
 
 #endif
@@ -3,17 +3,37 @@
 
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <list>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "container_stats.h"
+
 namespace container {
-	template<typename Key, typename Type, typename Hash = std::hash<Key>>
+	// Detects hashers that opt into heterogeneous lookup - same protocol as std::unordered_map:
+	// declaring is_transparent promises operator() accepts anything comparable against Key (e.g
+	// std::hash<std::string> extended with string_view/const char* overloads). The lookup members
+	// then gain templated overloads that hash and compare the argument directly, instead of
+	// materializing a temporary Key on every probe.
+	template<typename Hash>
+	concept transparent_hash = requires { typename Hash::is_transparent; };
+
+	/* ValueIndex (default off) maintains a secondary value->key index next to the primary table, so
+	   contains_value() and remove_by_value() go from a full scan of every bucket to an average O(1)
+	   index lookup - at the cost of one extra (Type, Key) entry per element. Requires Type to be
+	   hashable and equality-comparable. The index maps values to KEYS rather than buckets: keys are
+	   stable across rehashes, so migrations never have to touch it. One caveat: mutating a mapped
+	   value through operator[], at(), find() or an iterator bypasses the index - use
+	   insert_or_assign() to update values when the index is enabled. */
+	template<typename Key, typename Type, typename Hash = std::hash<Key>, bool ValueIndex = false>
 	class HashTable {
 	private:
 		using hash_table = std::vector<std::list<std::pair<const Key, Type>>>;
@@ -21,11 +41,44 @@ namespace container {
 		Hash m_hash;						   // Keep track of the constructed hash through e.g the constructors, so we can use it for the hashing functions in the STL
 									   // Grow factor must be defined before m_bucket_count, otherwise we can't initialize the latter properly (initialization happens from top-bottom)
 		inline static const double grow_factor = 2.0;     	   // The size of the table has to be a bit bigger than the total elements, to avoid too many collisions
-		inline static const double m_max_load_factor = 1.0;	   // Whenever the load factor is > than 0.75 we'll need to rehash
+		double m_max_load_factor = 1.0;				   // Per instance: the max_load_factor(double) setter couldn't compile while this was static const
+		inline static const std::size_t min_buckets = 16;	   // First allocation of a default-constructed table
 		std::size_t m_bucket_count{};				   // size of vector (= total buckets)
+		[[no_unique_address]] mutable hash_table_stats m_stats;		   // Empty unless CONTAINER_INSTRUMENTATION (see container_stats.h)
 		std::vector<std::list<std::pair<const Key, Type>>> m_table;  // Actual hash table - each vector's element is composed off by a list - each list contains Key-Value pairs
 		// static used since all classes will share the same value (which is const), but also to make sure we can use the implicitly-declared move constructor
 
+		// Incremental rehashing (opt-in, see incremental_rehash()): instead of moving every element
+		// in one O(n) burst, a triggered rehash allocates the larger table and parks the old buckets
+		// here; each subsequent modifying operation then splices a few buckets over. Lookups consult
+		// both tables until m_old_table drains, which bounds the latency of any single operation.
+		bool m_incremental{ false };
+		hash_table m_old_table{};
+		std::size_t m_migrate_pos{};			   // Next old bucket to migrate
+		inline static const std::size_t migrate_step = 8;  // Old buckets moved per modifying operation
+
+		// Reverse value->key index (see class comment); collapses to an empty member when disabled
+		struct no_value_index {};
+		using value_index_type = std::conditional_t<ValueIndex, std::unordered_multimap<Type, Key>, no_value_index>;
+		[[no_unique_address]] value_index_type m_value_index{};
+
+		constexpr void index_add(const Key& key, const Type& value) {
+			if constexpr (ValueIndex)
+				m_value_index.emplace(value, key);
+		}
+
+		constexpr void index_remove(const Key& key, const Type& value) {
+			if constexpr (ValueIndex) {
+				auto [first, last] = m_value_index.equal_range(value);
+				for (; first != last; ++first) {
+					if (first->second == key) {
+						m_value_index.erase(first);
+						return;
+					}
+				}
+			}
+		}
+
 
 	public:
 		using key_type = Key;
@@ -39,6 +92,96 @@ namespace container {
 		using pointer = value_type*;
 		using const_pointer = const pointer;
 
+	private:
+		/* Forward iterator over every key-value pair: walks the bucket vector and, inside each
+		   bucket, the list of pairs - skipping empty buckets. Iterating and find() hand out
+		   references into the table itself, so no copy of the bucket structure is made (get_table()
+		   used to be the only way in, and it copied the entire table). */
+		template<bool IsConst>
+		class table_iterator {
+		private:
+			using outer_iter = std::conditional_t<IsConst, typename hash_table::const_iterator, typename hash_table::iterator>;
+			using inner_iter = std::conditional_t<IsConst,
+				typename std::list<std::pair<const Key, Type>>::const_iterator,
+				typename std::list<std::pair<const Key, Type>>::iterator>;
+
+			outer_iter m_bucket{};
+			outer_iter m_last{};
+			inner_iter m_element{};
+			// Optional second bucket range, chained after the first: used while an incremental
+			// rehash is in flight so iteration covers the not-yet-migrated old table and then the
+			// new one. Empty (first == last) in normal operation.
+			outer_iter m_chain_first{};
+			outer_iter m_chain_last{};
+
+			// Moves to the first element of the next non-empty bucket whenever the current position
+			// is exhausted (or started out on an empty bucket)
+			constexpr void skip_empty_buckets() {
+				while (true) {
+					while (m_bucket != m_last && m_element == m_bucket->end()) {
+						++m_bucket;
+						if (m_bucket != m_last)
+							m_element = m_bucket->begin();
+					}
+					if (m_bucket != m_last || m_chain_first == m_chain_last)
+						return;
+					// First range exhausted: continue into the chained one
+					m_bucket = m_chain_first;
+					m_last = m_chain_last;
+					m_chain_first = m_chain_last;
+					if (m_bucket != m_last)
+						m_element = m_bucket->begin();
+				}
+			}
+
+			friend class HashTable;
+
+		public:
+			using value_type = std::pair<const Key, Type>;
+			using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+			using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+
+			constexpr table_iterator() = default;
+
+			constexpr table_iterator(outer_iter bucket, outer_iter last, inner_iter element,
+				outer_iter chain_first = {}, outer_iter chain_last = {})
+				: m_bucket{ bucket }, m_last{ last }, m_element{ element }
+				, m_chain_first{ chain_first }, m_chain_last{ chain_last } {
+				if (m_bucket != m_last || m_chain_first != m_chain_last)
+					skip_empty_buckets();
+			}
+
+			constexpr reference operator*() const noexcept { return *m_element; }
+			constexpr pointer operator->() const noexcept { return &*m_element; }
+
+			constexpr table_iterator& operator++() {
+				++m_element;
+				skip_empty_buckets();
+				return *this;
+			}
+
+			constexpr table_iterator operator++(int) {
+				table_iterator tmp(*this);
+				++(*this);
+				return tmp;
+			}
+
+			constexpr friend bool operator==(const table_iterator& first, const table_iterator& second) {
+				if (first.m_bucket != second.m_bucket) return false;
+				return first.m_bucket == first.m_last || first.m_element == second.m_element;
+			}
+
+			constexpr friend bool operator!=(const table_iterator& first, const table_iterator& second) {
+				return !(first == second);
+			}
+		};
+
+	public:
+		using iterator = table_iterator<false>;
+		using const_iterator = table_iterator<true>;
+
 		// Default constructor
 		constexpr HashTable(const hasher& hash = Hash())
 			: m_size{ 0 }
@@ -51,10 +194,10 @@ namespace container {
 		// Each item in the list is a key-value pair: thus we can directly use the hash functions through the Key, and use said key with the hash-function, which returns a value of type std::size_t. This is used
 		// for fast-indexing on our vector (which itself contains a hash table)
 		constexpr explicit HashTable(std::initializer_list<value_type> list, const hasher& hash = Hash())
-			: m_size{ list.size() }
+			: m_size{ 0 }	   // insert() counts each element; seeding list.size() double-counted
 			, m_hash{ hash }
-			, m_bucket_count{ static_cast<size_type>(list.size() * grow_factor) }
-			, m_table(static_cast<size_type>(list.size()* grow_factor)) // Note: () needed here to disambiguate ({} would call vector's initializer_list constructor)
+			, m_bucket_count{ std::bit_ceil(static_cast<size_type>(list.size() * grow_factor)) }
+			, m_table(std::bit_ceil(static_cast<size_type>(list.size() * grow_factor))) // Note: () needed here to disambiguate ({} would call vector's initializer_list constructor)
 		{
 			for (auto current : list) {
 				insert(current);
@@ -69,6 +212,11 @@ namespace container {
 			, m_hash{ other.m_hash }
 			, m_size{ other.m_size }
 			, m_table{ other.m_table }
+			, m_max_load_factor{ other.m_max_load_factor }
+			, m_incremental{ other.m_incremental }
+			, m_old_table{ other.m_old_table }
+			, m_migrate_pos{ other.m_migrate_pos }
+			, m_value_index{ other.m_value_index }
 		{}
 
 		constexpr HashTable(HashTable&& other) noexcept
@@ -108,8 +256,12 @@ namespace container {
 		// Modifiers
 		constexpr void clear() noexcept {
 			m_table.clear();
+			m_old_table.clear();
+			m_migrate_pos = 0;
 			m_size = 0;
 			m_bucket_count = 0;
+			if constexpr (ValueIndex)
+				m_value_index.clear();
 		}
 
 	private:
@@ -122,28 +274,135 @@ namespace container {
 			return false;
 		}
 
+		// A default-constructed table owns no buckets at all; give it some before the first insertion
+		// (indexing into the empty vector used to be undefined behaviour)
+		constexpr void ensure_buckets() {
+			if (m_bucket_count == 0)
+				rehash(min_buckets);
+		}
+
+		// Bucket counts are kept at powers of two (every growth site rounds up through std::bit_ceil),
+		// which turns the modulo on every hot path into a single mask - integer division is one of the
+		// slowest ALU operations and it used to sit in front of each lookup and insertion
+		// Templated on the key so the transparent overloads below can index without building a Key
+		template<typename K>
+		constexpr size_type bucket_index(const K& key) const {
+			return m_hash(key) & (m_bucket_count - 1);
+		}
+
+		template<typename K>
+		constexpr size_type old_bucket_index(const K& key) const {
+			return m_hash(key) & (m_old_table.size() - 1);
+		}
+
+		// Points at the not-yet-migrated element with this key, or nullptr. Only ever non-null while
+		// an incremental rehash is in flight.
+		template<typename K>
+		constexpr value_type* find_pending(const K& key) {
+			if (m_old_table.empty()) return nullptr;
+			auto& bucket{ m_old_table[old_bucket_index(key)] };
+			for (auto& element : bucket) {
+				if (element.first == key)
+					return &element;
+			}
+			return nullptr;
+		}
+
+		template<typename K>
+		constexpr const value_type* find_pending(const K& key) const {
+			if (m_old_table.empty()) return nullptr;
+			const auto& bucket{ m_old_table[old_bucket_index(key)] };
+			for (const auto& element : bucket) {
+				if (element.first == key)
+					return &element;
+			}
+			return nullptr;
+		}
+
+		// Splices up to migrate_step old buckets into the new table. splice() relinks list nodes, so
+		// no pair is copied or reallocated and references to elements stay valid.
+		constexpr void migrate_some() {
+			if (m_old_table.empty()) return;
+			for (size_type steps{ 0 }; steps < migrate_step && m_migrate_pos < m_old_table.size(); ++steps, ++m_migrate_pos) {
+				auto& bucket{ m_old_table[m_migrate_pos] };
+				while (!bucket.empty()) {
+					const size_type index{ bucket_index(bucket.front().first) };
+					m_table[index].splice(m_table[index].begin(), bucket, bucket.begin());
+				}
+			}
+			if (m_migrate_pos >= m_old_table.size()) {
+				m_old_table.clear();
+				m_migrate_pos = 0;
+			}
+		}
+
+		constexpr void begin_incremental_rehash(size_type n) {
+			CONTAINER_STATS(++m_stats.rehashes);
+			finish_rehash();			 // Never run two migrations at once
+			m_old_table.swap(m_table);
+			m_bucket_count = std::bit_ceil(n);
+			m_table = hash_table(m_bucket_count);
+			m_migrate_pos = 0;
+		}
+
+		// Called whenever the load factor crosses the limit
+		constexpr void grow_table() {
+			if (m_incremental)
+				begin_incremental_rehash(static_cast<size_type>(m_bucket_count * grow_factor));
+			else
+				rehash();
+		}
+
+	public:
+		// Opts in (or out of) incremental rehashing. Takes effect at the next triggered rehash;
+		// explicit rehash(n)/reserve(n) calls stay all-at-once.
+		constexpr void incremental_rehash(bool enable) noexcept {
+			m_incremental = enable;
+		}
+
+		constexpr bool rehash_in_progress() const noexcept {
+			return !m_old_table.empty();
+		}
+
+		// Drains a pending migration in one go
+		constexpr void finish_rehash() {
+			while (!m_old_table.empty())
+				migrate_some();
+		}
+
 	public:
-		// Should be O(1) average, O(n) if rehashing is done (on average)
+		// Should be O(1) average, O(n) if rehashing is done (on average); O(migrate_step) extra work
+		// while an incremental rehash is draining
 		constexpr bool insert(const value_type& value) {
-			size_type index{ m_hash(value.first) % m_bucket_count };
+			migrate_some();
+			ensure_buckets();
+			size_type index{ bucket_index(value.first) };
 			auto& bucket{ m_table.at(index) };
-			if (key_found(bucket, value)) return false;
+			if (key_found(bucket, value) || find_pending(value.first)) return false;
 			bucket.push_front(value);
+			CONTAINER_STATS(if (bucket.size() > 1) ++m_stats.collisions);
+			CONTAINER_STATS(m_stats.max_chain_length = std::max<std::size_t>(m_stats.max_chain_length, bucket.size()));
+			index_add(value.first, value.second);
 			++m_size;
 			if (calculate_load_factor() > m_max_load_factor) {
-				rehash();
+				grow_table();
 			}
 			return true;
 		}
 
 		constexpr bool insert(value_type&& value) {
-			size_type index{ m_hash(value.first) % m_bucket_count };
+			migrate_some();
+			ensure_buckets();
+			size_type index{ bucket_index(value.first) };
 			auto& bucket{ m_table.at(index) };
-			if (key_found(bucket, value)) return false;
+			if (key_found(bucket, value) || find_pending(value.first)) return false;
 			bucket.push_front(std::move(value));
+			CONTAINER_STATS(if (bucket.size() > 1) ++m_stats.collisions);
+			CONTAINER_STATS(m_stats.max_chain_length = std::max<std::size_t>(m_stats.max_chain_length, bucket.size()));
+			index_add(bucket.front().first, bucket.front().second);
 			++m_size;
 			if (calculate_load_factor() > m_max_load_factor) {
-				rehash();
+				grow_table();
 			}
 			return true;
 		}
@@ -157,47 +416,112 @@ namespace container {
 		template<typename Val>
 		// Amortized O(1); worst case O(n)
 		constexpr bool insert_or_assign(const Key& key, Val&& value) {
-			size_type index{ m_hash(key) % m_bucket_count };
+			migrate_some();
+			ensure_buckets();
+			size_type index{ bucket_index(key) };
 			auto& bucket{ m_table.at(index) };
 			// Search for the key. If it exists, assign value to that key. Otherwise, insert the new value (through std::pair<key, std::forward<Val>(value))
 			for (auto& element : bucket) {
 				if (element.first == key) {
+					index_remove(key, element.second);
 					element.second = value;
+					index_add(key, element.second);
 					return false;
 				}
 			}
+			if (value_type* pending = find_pending(key)) {
+				index_remove(key, pending->second);
+				pending->second = std::forward<Val>(value);
+				index_add(key, pending->second);
+				return false;
+			}
 			return insert(std::pair<Key, mapped_type>(key, std::forward<Val>(value)));
 		}
 
 		template<typename...Args>
 		constexpr bool emplace(Args&&...args) {
-			size_type index{ m_hash(std::pair<Key,Type>(std::forward<Args>(args)...).first) % m_bucket_count };
+			migrate_some();
+			ensure_buckets();
+			// Built once up front: the old version re-constructed this pair from the forwarded
+			// arguments for the index and again for the duplicate check
+			std::pair<Key, Type> value(std::forward<Args>(args)...);
+			size_type index{ bucket_index(value.first) };
 			auto& bucket{ m_table.at(index) };
-			if (key_found(bucket, std::pair<Key, Type>(std::forward<Args>(args)...))) return false;
-			bucket.emplace_front(std::forward<Args>(args)...);
+			if (key_found(bucket, value) || find_pending(value.first)) return false;
+			bucket.emplace_front(std::move(value.first), std::move(value.second));
+			CONTAINER_STATS(if (bucket.size() > 1) ++m_stats.collisions);
+			CONTAINER_STATS(m_stats.max_chain_length = std::max<std::size_t>(m_stats.max_chain_length, bucket.size()));
+			index_add(bucket.front().first, bucket.front().second);
 			++m_size;
 			if (calculate_load_factor() > m_max_load_factor) {
-				rehash();
+				grow_table();
 			}
 			return true;
 		}
 
 		// Average O(1) [e.g list doesn't contain lots of elements], forst O(n)
 		constexpr bool remove_by_key(const Key& key) {
-			size_type index{ m_hash(key) % m_bucket_count };
+			if (m_bucket_count == 0) return false;
+			migrate_some();
+			size_type index{ bucket_index(key) };
 			auto& bucket{ m_table.at(index) };
 			for (const auto& elem : bucket) {
 				if (elem.first == key) {
+					index_remove(elem.first, elem.second);
 					bucket.remove(elem);
 					--m_size;
 					return true;
 				}
 			}
+			if (!m_old_table.empty()) {
+				auto& old_bucket{ m_old_table[old_bucket_index(key)] };
+				for (const auto& elem : old_bucket) {
+					if (elem.first == key) {
+						index_remove(elem.first, elem.second);
+						old_bucket.remove(elem);
+						--m_size;
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+
+		template<typename K> requires transparent_hash<hasher>
+		constexpr bool remove_by_key(const K& key) {
+			if (m_bucket_count == 0) return false;
+			migrate_some();
+			auto& bucket{ m_table.at(bucket_index(key)) };
+			for (const auto& elem : bucket) {
+				if (elem.first == key) {
+					index_remove(elem.first, elem.second);
+					bucket.remove(elem);
+					--m_size;
+					return true;
+				}
+			}
+			if (!m_old_table.empty()) {
+				auto& old_bucket{ m_old_table[old_bucket_index(key)] };
+				for (const auto& elem : old_bucket) {
+					if (elem.first == key) {
+						index_remove(elem.first, elem.second);
+						old_bucket.remove(elem);
+						--m_size;
+						return true;
+					}
+				}
+			}
 			return false;
 		}
 
-		// Average O(n) [eg. list doesn't contain lots of elements], worst O(n^2)
+		// Average O(1) with ValueIndex enabled; otherwise average O(n), worst O(n^2)
 		constexpr bool remove_by_value(const Type& value) {
+			if constexpr (ValueIndex) {
+				const auto found = m_value_index.find(value);
+				if (found == m_value_index.end())
+					return false;
+				return remove_by_key(found->second);	// Erases the index entry too
+			}
 			for (size_type index{ 0 }; auto & current_list : m_table) {
 				for (auto& current_pair : current_list) {
 					if (current_pair.second == value) {
@@ -208,61 +532,265 @@ namespace container {
 				}
 				++index;
 			}
+			for (size_type index{ 0 }; auto & current_list : m_old_table) {
+				for (auto& current_pair : current_list) {
+					if (current_pair.second == value) {
+						m_old_table.at(index).remove(current_pair);
+						--m_size;
+						return true;
+					}
+				}
+				++index;
+			}
 			return false;
 		}
 
+		// Iterators. While an incremental rehash is in flight, iteration covers the old buckets
+		// first and then chains into the new table, so no element is skipped.
+		constexpr iterator begin() noexcept {
+			if (!m_old_table.empty())
+				return iterator(m_old_table.begin(), m_old_table.end(), m_old_table.begin()->begin(), m_table.begin(), m_table.end());
+			return m_table.empty() ? end() : iterator(m_table.begin(), m_table.end(), m_table.begin()->begin());
+		}
+
+		constexpr const_iterator begin() const noexcept {
+			if (!m_old_table.empty())
+				return const_iterator(m_old_table.begin(), m_old_table.end(), m_old_table.begin()->begin(), m_table.begin(), m_table.end());
+			return m_table.empty() ? end() : const_iterator(m_table.begin(), m_table.end(), m_table.begin()->begin());
+		}
+
+		constexpr const_iterator cbegin() const noexcept {
+			return begin();
+		}
+
+		constexpr iterator end() noexcept {
+			return iterator(m_table.end(), m_table.end(), {});
+		}
+
+		constexpr const_iterator end() const noexcept {
+			return const_iterator(m_table.end(), m_table.end(), {});
+		}
+
+		constexpr const_iterator cend() const noexcept {
+			return end();
+		}
+
+		// Average O(1), worst O(n). Returns end() when the key is absent; the resulting iterator
+		// points straight into the bucket, no pair is copied.
+		constexpr iterator find(const Key& key) {
+			if (m_bucket_count == 0) return end();
+			const size_type index{ bucket_index(key) };
+			auto& bucket{ m_table.at(index) };
+			for (auto current = bucket.begin(); current != bucket.end(); ++current) {
+				CONTAINER_STATS(++m_stats.probe_steps);
+				if (current->first == key)
+					return iterator(m_table.begin() + index, m_table.end(), current);
+			}
+			if (!m_old_table.empty()) {
+				const size_type old_index{ old_bucket_index(key) };
+				auto& old_bucket{ m_old_table[old_index] };
+				for (auto current = old_bucket.begin(); current != old_bucket.end(); ++current) {
+					if (current->first == key)
+						return iterator(m_old_table.begin() + old_index, m_old_table.end(), current, m_table.begin(), m_table.end());
+				}
+			}
+			return end();
+		}
+
+		constexpr const_iterator find(const Key& key) const {
+			if (m_bucket_count == 0) return end();
+			const size_type index{ bucket_index(key) };
+			const auto& bucket{ m_table.at(index) };
+			for (auto current = bucket.begin(); current != bucket.end(); ++current) {
+				CONTAINER_STATS(++m_stats.probe_steps);
+				if (current->first == key)
+					return const_iterator(m_table.begin() + index, m_table.end(), current);
+			}
+			if (!m_old_table.empty()) {
+				const size_type old_index{ old_bucket_index(key) };
+				const auto& old_bucket{ m_old_table[old_index] };
+				for (auto current = old_bucket.begin(); current != old_bucket.end(); ++current) {
+					if (current->first == key)
+						return const_iterator(m_old_table.begin() + old_index, m_old_table.end(), current, m_table.begin(), m_table.end());
+				}
+			}
+			return end();
+		}
+
+		// Heterogeneous find: probes with the argument as-is (string_view, const char*, ...) when the
+		// hasher is transparent, so no temporary Key is allocated
+		template<typename K> requires transparent_hash<hasher>
+		constexpr iterator find(const K& key) {
+			if (m_bucket_count == 0) return end();
+			const size_type index{ bucket_index(key) };
+			auto& bucket{ m_table.at(index) };
+			for (auto current = bucket.begin(); current != bucket.end(); ++current) {
+				CONTAINER_STATS(++m_stats.probe_steps);
+				if (current->first == key)
+					return iterator(m_table.begin() + index, m_table.end(), current);
+			}
+			if (!m_old_table.empty()) {
+				const size_type old_index{ old_bucket_index(key) };
+				auto& old_bucket{ m_old_table[old_index] };
+				for (auto current = old_bucket.begin(); current != old_bucket.end(); ++current) {
+					if (current->first == key)
+						return iterator(m_old_table.begin() + old_index, m_old_table.end(), current, m_table.begin(), m_table.end());
+				}
+			}
+			return end();
+		}
+
+		template<typename K> requires transparent_hash<hasher>
+		constexpr const_iterator find(const K& key) const {
+			if (m_bucket_count == 0) return end();
+			const size_type index{ bucket_index(key) };
+			const auto& bucket{ m_table.at(index) };
+			for (auto current = bucket.begin(); current != bucket.end(); ++current) {
+				CONTAINER_STATS(++m_stats.probe_steps);
+				if (current->first == key)
+					return const_iterator(m_table.begin() + index, m_table.end(), current);
+			}
+			if (!m_old_table.empty()) {
+				const size_type old_index{ old_bucket_index(key) };
+				const auto& old_bucket{ m_old_table[old_index] };
+				for (auto current = old_bucket.begin(); current != old_bucket.end(); ++current) {
+					if (current->first == key)
+						return const_iterator(m_old_table.begin() + old_index, m_old_table.end(), current, m_table.begin(), m_table.end());
+				}
+			}
+			return end();
+		}
+
+		// Keys are unique here, so the range holds zero or one element - offered anyway to match
+		// the std::unordered_map interface (generic code iterates the range either way)
+		constexpr std::pair<iterator, iterator> equal_range(const Key& key) {
+			iterator first = find(key);
+			if (first == end()) return { first, first };
+			iterator last = first;
+			return { first, ++last };
+		}
+
+		constexpr std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+			const_iterator first = find(key);
+			if (first == end()) return { first, first };
+			const_iterator last = first;
+			return { first, ++last };
+		}
+
+		template<typename K> requires transparent_hash<hasher>
+		constexpr std::pair<iterator, iterator> equal_range(const K& key) {
+			iterator first = find(key);
+			if (first == end()) return { first, first };
+			iterator last = first;
+			return { first, ++last };
+		}
+
+		template<typename K> requires transparent_hash<hasher>
+		constexpr std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+			const_iterator first = find(key);
+			if (first == end()) return { first, first };
+			const_iterator last = first;
+			return { first, ++last };
+		}
+
 		// Lookup functions
 		constexpr Type& at(const Key& key) {
-			size_type index{ m_hash(key) % m_bucket_count };
+			size_type index{ bucket_index(key) };
 			auto& current_list{ m_table.at(index) };
 			for (auto& current : current_list) {
 				if (current.first == key)
 					return current.second;
 			}
+			if (value_type* pending = find_pending(key))
+				return pending->second;
 			throw std::out_of_range("Specified key is not associated with any element");
 		}
 
 		constexpr const Type& at(const Key& key) const {
-			size_type index{ m_hash(key) % m_size };
+			size_type index{ bucket_index(key) };
 			auto& current_list{ m_table.at(index) };
 			for (const auto& current : current_list) {
 				if (current.first == key)
 					return current.second;
 			}
+			if (const value_type* pending = find_pending(key))
+				return pending->second;
+			throw std::out_of_range("Specified key is not associated with any element");
+		}
+
+		template<typename K> requires transparent_hash<hasher>
+		constexpr Type& at(const K& key) {
+			if (m_bucket_count != 0) {
+				for (auto& current : m_table.at(bucket_index(key))) {
+					if (current.first == key)
+						return current.second;
+				}
+				if (value_type* pending = find_pending(key))
+					return pending->second;
+			}
+			throw std::out_of_range("Specified key is not associated with any element");
+		}
+
+		template<typename K> requires transparent_hash<hasher>
+		constexpr const Type& at(const K& key) const {
+			if (m_bucket_count != 0) {
+				for (const auto& current : m_table.at(bucket_index(key))) {
+					if (current.first == key)
+						return current.second;
+				}
+				if (const value_type* pending = find_pending(key))
+					return pending->second;
+			}
 			throw std::out_of_range("Specified key is not associated with any element");
 		}
 
 
 		constexpr Type& operator[](const Key& key) {
-			size_type index{ m_hash(key) % m_bucket_count };
+			size_type index{ bucket_index(key) };
 			auto& current_list{ m_table.at(index) };
 			for (auto& current : current_list) {
 				if (current.first == key)
 					return current.second;
 			}
+			if (value_type* pending = find_pending(key))
+				return pending->second;
 			return current_list.front().second;
 		}
 
 		constexpr const Type& operator[](const Key& key) const {
-			size_type index{ m_hash(key) % m_bucket_count };
+			size_type index{ bucket_index(key) };
 			auto& current_list{ m_table.at(index) };
 			for (const auto& current : current_list) {
 				if (current.first == key)
 					return current.second;
 			}
+			if (const value_type* pending = find_pending(key))
+				return pending->second;
 			return current_list.front().second;
 		}
 
 		// Average O(1), worst case O(n)
 		constexpr size_type count(const Key& key) const {
-			size_type index{ m_hash(key) % m_bucket_count };
+			if (m_bucket_count == 0) return 0;
+			size_type index{ bucket_index(key) };
 			auto& bucket{ m_table.at(index) };
 			for (const auto& elem : bucket) {
 				if (elem.first == key) {
 					return 1;
 				}
 			}
-			return 0;
+			return find_pending(key) != nullptr ? 1 : 0;
+		}
+
+		template<typename K> requires transparent_hash<hasher>
+		constexpr size_type count(const K& key) const {
+			if (m_bucket_count == 0) return 0;
+			for (const auto& elem : m_table.at(bucket_index(key))) {
+				if (elem.first == key) {
+					return 1;
+				}
+			}
+			return find_pending(key) != nullptr ? 1 : 0;
 		}
 
 		// Average O(1), worst O(n)
@@ -270,8 +798,16 @@ namespace container {
 			return count(key) == 1 ? true : false;
 		}
 
-		// Average O(n), worst O(n^2)
+		template<typename K> requires transparent_hash<hasher>
+		constexpr bool contains_key(const K& key) const {
+			return count(key) == 1 ? true : false;
+		}
+
+		// Average O(1) with ValueIndex enabled; otherwise average O(n), worst O(n^2)
 		constexpr bool contains_value(const Type& value) const {
+			if constexpr (ValueIndex) {
+				return m_value_index.find(value) != m_value_index.end();
+			}
 			for (size_type index{ 0 }; auto & current_list : m_table) {
 				for (auto& current_pair : current_list) {
 					if (current_pair.second == value) {
@@ -279,6 +815,13 @@ namespace container {
 					}
 				}
 			}
+			for (const auto& current_list : m_old_table) {
+				for (const auto& current_pair : current_list) {
+					if (current_pair.second == value) {
+						return true;
+					}
+				}
+			}
 			return false;
 		}
 
@@ -296,7 +839,7 @@ namespace container {
 		}
 
 		constexpr size_type bucket(const Key& key) const {
-			const size_type index{ m_hash(key) % m_bucket_count };
+			const size_type index{ bucket_index(key) };
 			return index;
 		}
 
@@ -305,6 +848,11 @@ namespace container {
 			return calculate_load_factor();
 		}
 
+		// Slow-path counters, populated only under CONTAINER_INSTRUMENTATION (empty struct otherwise)
+		constexpr const hash_table_stats& stats() const noexcept {
+			return m_stats;
+		}
+
 		constexpr double max_load_factor() const noexcept {
 			return m_max_load_factor;
 		}
@@ -314,8 +862,7 @@ namespace container {
 		}
 
 		constexpr void reserve(size_type count) {
-			m_bucket_count = count;
-			rehash(count);
+			rehash(count);	// rehash() itself rounds the count up to a power of two
 		}
 
 	private:
@@ -325,10 +872,14 @@ namespace container {
 
 		// Average case O(n), worst O(n^2)
 		constexpr void rehash(size_type n) {
+			CONTAINER_STATS(++m_stats.rehashes);
+			finish_rehash();	     // An explicit rehash supersedes any pending migration
 			hash_table temp{ m_table };  // Copy the contents of the current hash table
 			m_table.clear();	     // Remove all elements from our table
 			m_size = 0;		     // Reset the size (total elements in the table). The insert function will increase it on each insertion.
-			m_bucket_count = n;	     // Double the total number of buckets
+			if constexpr (ValueIndex)
+				m_value_index.clear();   // The reinsertions below rebuild it
+			m_bucket_count = std::bit_ceil(n);   // Rounded up so bucket_index() can keep masking
 			m_table.resize(m_bucket_count);
 			for (const auto& current_bucket : temp) {
 				for (const auto& current_pair : current_bucket) {
@@ -339,10 +890,14 @@ namespace container {
 
 	public:
 		constexpr void rehash() {
-			hash_table temp{ m_table };	  
-			m_table.clear();			 
-			m_size = 0;					  
-			m_bucket_count = static_cast<size_type>(m_bucket_count * grow_factor); 
+			CONTAINER_STATS(++m_stats.rehashes);
+			finish_rehash();
+			hash_table temp{ m_table };
+			m_table.clear();
+			m_size = 0;
+			if constexpr (ValueIndex)
+				m_value_index.clear();
+			m_bucket_count = std::bit_ceil(static_cast<size_type>(m_bucket_count * grow_factor));
 			m_table.resize(m_bucket_count);
 			for (const auto& current_bucket : temp) {
 				for (const auto& current_pair : current_bucket) {
@@ -352,7 +907,8 @@ namespace container {
 		}
 
 	public:
-		constexpr const hash_table get_table() const noexcept {
+		// Returns a reference: this used to hand back a full copy of every bucket and node
+		constexpr const hash_table& get_table() const noexcept {
 			return m_table;
 		}
 
@@ -361,6 +917,11 @@ namespace container {
 			std::swap(m_bucket_count, other.m_bucket_count);
 			std::swap(m_hash, other.m_hash);
 			std::swap(m_table, other.m_table);
+			std::swap(m_max_load_factor, other.m_max_load_factor);
+			std::swap(m_incremental, other.m_incremental);
+			std::swap(m_old_table, other.m_old_table);
+			std::swap(m_migrate_pos, other.m_migrate_pos);
+			std::swap(m_value_index, other.m_value_index);
 		}
 	};
 }
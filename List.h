@@ -9,11 +9,14 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+
+#include "container_stats.h"
 #include <type_traits>
 #include <utility>
 
 namespace container {
-	template<typename T>
+	template<typename Type, typename Allocator = std::allocator<Type>>
 	class List {
 	private:
 		constexpr void deallocate(List& other) noexcept {
@@ -21,7 +24,7 @@ namespace container {
 				Node* current_node = other.m_head;
 				while (current_node != nullptr) {
 					Node* next_node = current_node->next;
-					delete current_node;
+					other.destroy_node(current_node);	// other's allocator owns these nodes
 					current_node = next_node;
 				}
 			}
@@ -32,9 +35,10 @@ namespace container {
 
 	private:
 		struct Node {
-			T data;
+			Type data;
 			Node* next;
 			Node* prev;
+			bool pooled = false;	// Lives inside a Block: never handed back to the allocator alone
 			Node() = default;
 			template<typename...Args>
 			constexpr explicit Node(Args&&... args)
@@ -42,9 +46,132 @@ namespace container {
 			{}
 		};
 
-		Node* m_head;
-		Node* m_tail;
-		std::size_t m_size;
+		/* Bulk-construction backing store, same scheme as ForwardList: when the final node count is
+		known up front (sized ranges, count constructors, copies) the nodes are carved out of
+		contiguous blocks, one allocation per block_size nodes instead of one per node, and a fresh
+		list comes out sequential in memory. Pooled nodes recycle through the freelist like any
+		other but only the whole block is ever deallocated. */
+		static constexpr std::size_t block_size = 256;
+
+		struct Block {
+			Block* next = nullptr;
+			alignas(Node) std::byte storage[block_size * sizeof(Node)];
+
+			Node* node(std::size_t index) noexcept {
+				return reinterpret_cast<Node*>(storage) + index;
+			}
+		};
+
+		// Rebound to the node type so every link goes through allocator_traits, same scheme as
+		// ForwardList: hand in e.g a std::pmr::monotonic_buffer_resource and per-node malloc is gone
+		using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+		using node_alloc_traits = std::allocator_traits<node_allocator>;
+		using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+		using block_alloc_traits = std::allocator_traits<block_allocator>;
+
+		Node* m_head = nullptr;
+		Node* m_tail = nullptr;
+		std::size_t m_size = 0;
+		Node* m_free = nullptr;		// Recycled nodes, chained through their next pointers
+		Block* m_blocks = nullptr;	// Bulk-allocated node blocks this list owns
+		[[no_unique_address]] list_stats m_stats;	// Empty unless CONTAINER_INSTRUMENTATION (see container_stats.h)
+		node_allocator m_allocator;
+
+		/* Builds `count` doubly linked nodes out of contiguous blocks; `make` yields each payload
+		in order. Only called on an empty list by the sized constructors. */
+		template<typename Maker>
+		constexpr void build_n(std::size_t count, Maker make) {
+			block_allocator block_alloc(m_allocator);
+			Node* prev = nullptr;
+			std::size_t built = 0;
+			while (built < count) {
+				Block* block = block_alloc_traits::allocate(block_alloc, 1);
+				block->next = m_blocks;
+				m_blocks = block;
+				CONTAINER_STATS(++m_stats.blocks_allocated);
+				const std::size_t in_block = std::min(block_size, count - built);
+				CONTAINER_STATS(m_stats.nodes_allocated += in_block);
+				for (std::size_t index = 0; index < in_block; ++index) {
+					Node* node = block->node(index);
+					std::construct_at(node, make());
+					node->pooled = true;
+					node->prev = prev;
+					if (prev != nullptr) { prev->next = node; }
+					else { m_head = node; }
+					prev = node;
+				}
+				built += in_block;
+			}
+			m_tail = prev;
+			m_tail->next = nullptr;
+		}
+
+		// Appends `other`'s node blocks to ours: whenever nodes migrate between lists wholesale
+		// (splice/merge) the storage that backs them has to follow
+		constexpr void adopt_blocks(List& other) noexcept {
+			other.trim();	// Its pooled free nodes point into the blocks changing hands
+			if (other.m_blocks == nullptr) { return; }
+			Block* last = other.m_blocks;
+			while (last->next != nullptr) {
+				last = last->next;
+			}
+			last->next = m_blocks;
+			m_blocks = other.m_blocks;
+			other.m_blocks = nullptr;
+		}
+
+		constexpr void release_blocks() noexcept {
+			block_allocator block_alloc(m_allocator);
+			while (m_blocks != nullptr) {
+				Block* next = m_blocks->next;
+				block_alloc_traits::deallocate(block_alloc, m_blocks, 1);
+				m_blocks = next;
+			}
+		}
+
+		/* Erased nodes stay with the list on an internal freelist instead of going back to the
+		allocator, and create_node() reuses them before allocating anything new - under steady
+		insert/erase churn (LRU caches being the usual case) the allocator drops out of the hot loop
+		entirely, and the LIFO order means the most recently freed, still cache-warm node comes back
+		first. Same scheme as ForwardList; trim() releases the pool. */
+		template<typename...Args>
+		constexpr Node* create_node(Args&&...args) {
+			if (m_free != nullptr) {
+				Node* node = m_free;
+				m_free = node->next;
+				CONTAINER_STATS(++m_stats.nodes_reused);
+				// Only the payload was destroyed when the node was recycled
+				std::construct_at(std::addressof(node->data), std::forward<Args>(args)...);
+				return node;
+			}
+			CONTAINER_STATS(++m_stats.nodes_allocated);
+			Node* node = node_alloc_traits::allocate(m_allocator, 1);
+			node_alloc_traits::construct(m_allocator, node, std::forward<Args>(args)...);
+			return node;
+		}
+
+		constexpr void destroy_node(Node* node) noexcept {
+			CONTAINER_STATS(++m_stats.nodes_freed);
+			std::destroy_at(std::addressof(node->data));
+			node->next = m_free;
+			m_free = node;
+		}
+
+	public:
+		// Returns the recycled nodes to the allocator. The payloads are long dead, so this is
+		// deallocation only - worth calling after a large shrink that won't be refilled. Pooled
+		// nodes just drop off the list: their storage belongs to a Block, freed only wholesale.
+		constexpr void trim() noexcept {
+			while (m_free != nullptr) {
+				Node* next = m_free->next;
+				if (!m_free->pooled) {
+					node_alloc_traits::deallocate(m_allocator, m_free, 1);
+				}
+				m_free = next;
+			}
+		}
+
+	private:
 
 		/* Bidirectional iterator */
 		template<typename T>
@@ -94,82 +221,59 @@ namespace container {
 
 	public:
 		// Aliases
-		using value_type = T;
+		using value_type = Type;
 		using size_type = std::size_t;
 		using difference_type = std::ptrdiff_t;
-		using const_reference = const value_type&;
 		using reference = value_type&;
 		using const_reference = const value_type&;
 		using pointer = value_type*;
 		using const_pointer = const value_type*;
 		using iterator = BidirectionalIterator<value_type>;
-		using const_iterator = BidirectionalIterator<const_reference>;
+		using const_iterator = BidirectionalIterator<const Type>;
 		using reverse_iterator = std::reverse_iterator<iterator>;
 		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+		using allocator_type = Allocator;
+		using const_alloc_reference = const allocator_type&;
 
 		constexpr List() noexcept
 			: m_head{ nullptr }, m_tail{ nullptr }, m_size{ 0 }
 		{}
 
-		constexpr explicit List(size_type count, const_reference value)
-			: m_size{ count } {
-			assert(count != 0 && "count is 0");
-			Node* current_node = new Node(value);
-			m_head = current_node;
-			m_head->prev = nullptr;
-			Node* tmp = m_head;
+		constexpr explicit List(const_alloc_reference allocator) noexcept
+			: m_allocator{ allocator }
+		{}
 
-			for (size_type index{ 0 }; index < count - 1; ++index) {
-				current_node->next = new Node(value);
-				current_node = current_node->next;
-				current_node->prev = tmp;
-				tmp = tmp->next;
-			}
-			m_tail = current_node;
-			m_tail->next = nullptr;
+		constexpr explicit List(size_type count, const_reference value, const_alloc_reference allocator = Allocator())
+			: m_size{ count }
+			, m_allocator{ allocator } {
+			assert(count != 0 && "count is 0");
+			build_n(count, [&value]() -> const_reference { return value; });
 		}
 
-		constexpr explicit List(size_type count)
-			: List(count, T())
+		constexpr explicit List(size_type count, const_alloc_reference allocator = Allocator())
+			: List(count, Type(), allocator)
 		{}
 
-		template<typename input_iter>
-		constexpr List(input_iter first, input_iter last)
-			: m_size{ static_cast<size_type>(std::distance(first, last)) } {
+		// Constrained like ForwardList's, so assign(5000, 7) and friends pick the count overload
+		template<std::input_iterator input_iter>
+		constexpr List(input_iter first, input_iter last, const_alloc_reference allocator = Allocator())
+			: m_size{ static_cast<size_type>(std::distance(first, last)) }
+			, m_allocator{ allocator } {
 			assert(first != last && "First == last");
-			Node* current_node = new Node(*first);
-			m_head = current_node;
-			m_head->prev = nullptr;
-			Node* tmp = m_head;
-			for (size_type index{ 0 }; index < m_size - 1; ++index) {
-				current_node->next = new Node(*(++first));
-				current_node = current_node->next;
-				current_node->prev = tmp;
-				tmp = tmp->next;
-			}
-			m_tail = current_node;
-			m_tail->next = nullptr;
+			build_n(m_size, [&first]() -> decltype(auto) { return *first++; });
 		}
 
-		constexpr List(const List& other) {
+		constexpr List(const List& other)
+			: m_allocator{ node_alloc_traits::select_on_container_copy_construction(other.m_allocator) } {
 			if (other.m_head) {
 				m_size = other.m_size;
-				Node* current_node = new Node(other.m_head->data);
 				Node* current_other_node = other.m_head;
-				m_head = current_node;
-				m_head->prev = nullptr;
-				Node* tmp = m_head;
-				while (current_other_node->next != nullptr) {
-					current_node->next = new Node(current_other_node->next->data);
-					current_node = current_node->next;
+				build_n(m_size, [&current_other_node]() -> const_reference {
+					const_reference data = current_other_node->data;
 					current_other_node = current_other_node->next;
-					current_node->prev = tmp;
-					tmp = tmp->next;
-				}
-				m_tail = current_node;
-				m_tail->next = nullptr;
+					return data;
+				});
 			}
-			else { List(); }
 		}
 
 		constexpr List(List&& other) noexcept
@@ -177,18 +281,29 @@ namespace container {
 			other.swap(*this);
 		}
 
-		constexpr List(std::initializer_list<T> list)
-			: List(std::begin(list), std::end(list))
+		constexpr List(std::initializer_list<Type> list, const_alloc_reference allocator = Allocator())
+			: List(std::begin(list), std::end(list), allocator)
 		{}
 
 		~List() {
 			Node* current_node = m_head;
 			while (current_node != nullptr) {
 				Node* next_node = current_node->next;
-				delete current_node;
+				destroy_node(current_node);
 				current_node = next_node;
 			}
 			m_head = nullptr;
+			trim();		// Everything above only moved the nodes onto the freelist
+			release_blocks();
+		}
+
+		// Node traffic counters, populated only under CONTAINER_INSTRUMENTATION (empty struct otherwise)
+		constexpr const list_stats& stats() const noexcept {
+			return m_stats;
+		}
+
+		constexpr allocator_type get_allocator() const noexcept {
+			return allocator_type(m_allocator);
 		}
 
 		constexpr List& operator=(const List& other) {
@@ -203,7 +318,7 @@ namespace container {
 			return *this;
 		}
 
-		constexpr List& operator=(std::initializer_list<T> list) {
+		constexpr List& operator=(std::initializer_list<Type> list) {
 			List temp{ list };
 			temp.swap(*this);
 			return *this;
@@ -215,14 +330,14 @@ namespace container {
 			temp_list.swap(*this);
 		}
 
-		template<typename input_iter>
+		template<std::input_iterator input_iter>
 		constexpr void assign(input_iter first, input_iter last) {
 			deallocate(*this);
 			List temp_list(first, last);
 			temp_list.swap(*this);
 		}
 
-		constexpr void assign(std::initializer_list<T> list) {
+		constexpr void assign(std::initializer_list<Type> list) {
 			assign(std::begin(list), std::end(list));
 		}
 
@@ -255,14 +370,17 @@ namespace container {
 		}
 
 		constexpr iterator end() noexcept {
+			if (m_tail == nullptr) { return nullptr; }
 			return iterator(m_tail->next);
 		}
 
 		constexpr const_iterator end() const noexcept {
+			if (m_tail == nullptr) { return nullptr; }
 			return const_iterator(m_tail->next);
 		}
 
 		constexpr const_iterator cend() const noexcept {
+			if (m_tail == nullptr) { return nullptr; }
 			return const_iterator(m_tail->next);
 		}
 
@@ -309,8 +427,14 @@ namespace container {
 		template<typename...Args>
 		constexpr iterator emplace(iterator pos, Args&&...args) {
 			Node* temp = pos.getNodeAddress();
-			Node* current_node = new Node(std::forward<Args>(args)...);
-			if (temp == m_head) {
+			Node* current_node = create_node(std::forward<Args>(args)...);
+			if (m_head == nullptr) {	// First element: becomes both head and tail
+				m_head = current_node;
+				m_tail = current_node;
+				current_node->prev = nullptr;
+				current_node->next = nullptr;
+			}
+			else if (temp == m_head) {
 				m_head->prev = current_node;
 				current_node->next = m_head;
 				m_head = current_node;
@@ -351,7 +475,7 @@ namespace container {
 			return (count == 0) ? pos : temp;
 		}
 
-		constexpr iterator insert(iterator pos, std::initializer_list<T> list) {
+		constexpr iterator insert(iterator pos, std::initializer_list<Type> list) {
 			iterator temp;
 			for (auto current : list) {
 				temp = emplace(pos, current);
@@ -377,7 +501,7 @@ namespace container {
 					next_temp->prev = prev_temp;
 				}
 				--m_size;
-				delete temp;
+				destroy_node(temp);
 			}
 			auto posit = pos;
 			return (++posit != nullptr) ? posit : end();
@@ -394,7 +518,7 @@ namespace container {
 			else {
 				while (firstNode_next != lastNode_temp) {
 					Node* temp = firstNode_next->next;
-					delete firstNode_next;
+					destroy_node(firstNode_next);
 					firstNode_next = temp;
 					--m_size;
 				}
@@ -421,14 +545,14 @@ namespace container {
 			Node* temp_tail = m_tail;
 			m_tail = m_tail->prev;
 			m_tail->next = nullptr;
-			delete temp_tail;
+			destroy_node(temp_tail);
 			--m_size;
 		}
 
 		template<typename...Args>
 		constexpr reference emplace_front(Args...args) {
 			Node* head_temp = m_head;
-			Node* current = new Node(std::forward<Args>(args)...);
+			Node* current = create_node(std::forward<Args>(args)...);
 			m_head = current;
 			m_head->next = head_temp;
 			m_head->prev = nullptr;
@@ -448,12 +572,12 @@ namespace container {
 			Node* head_temp = m_head;
 			Node* next_temp = m_head->next;
 			m_head = next_temp;
-			delete head_temp;
+			destroy_node(head_temp);
 			m_head->prev = nullptr;
 			--m_size;
 		}
 
-		constexpr void resize(size_type count, const_reference value = T()) {
+		constexpr void resize(size_type count, const_reference value = Type()) {
 			if (count < size()) {
 				if (count == 0) { deallocate(*this); }
 				else {
@@ -496,15 +620,104 @@ namespace container {
 			other.m_size = 0;
 			other.m_head = nullptr;
 			other.m_tail = nullptr;
+			adopt_blocks(other);
 		}
 
+	private:
+		/* Merges two sorted node chains in place by relinking the next pointers only - the data
+		never moves, and the prev pointers are rebuilt afterwards by relink_prev() in one pass.
+		Ties take from `first`, which is what keeps sort() stable. Same scheme as ForwardList. */
+		constexpr Node* merge_nodes(Node* first, Node* second) noexcept {
+			Node* head;
+			if (second->data < first->data) { head = second; second = second->next; }
+			else { head = first; first = first->next; }
+			Node* tail = head;
+			while (first != nullptr && second != nullptr) {
+				if (second->data < first->data) {
+					tail->next = second;
+					second = second->next;
+				}
+				else {
+					tail->next = first;
+					first = first->next;
+				}
+				tail = tail->next;
+			}
+			tail->next = (first != nullptr) ? first : second;
+			return head;
+		}
+
+		// Walks a freshly merged chain once, restoring the prev links and m_head/m_tail
+		constexpr void relink_prev(Node* head) noexcept {
+			head->prev = nullptr;
+			Node* current = head;
+			while (current->next != nullptr) {
+				current->next->prev = current;
+				current = current->next;
+			}
+			m_head = head;
+			m_tail = current;
+		}
+
+	public:
+		/* Bottom-up merge sort, the same scheme std::list uses: bins[i] holds a sorted run of 2^i
+		nodes, every incoming node cascades through the bins like a binary carry, and the surviving
+		runs are merged once at the end. O(n log n) comparisons, O(1) extra space, nodes relinked
+		instead of copied. */
+		constexpr void sort() {
+			if (m_size < 2) { return; }
+			Node* bins[64] = {};
+			int max_bin = 0;
+			Node* current = m_head;
+			while (current != nullptr) {
+				Node* next = current->next;
+				current->next = nullptr;
+				Node* carry = current;
+				int index = 0;
+				while (bins[index] != nullptr) {
+					carry = merge_nodes(bins[index], carry);
+					bins[index] = nullptr;
+					++index;
+				}
+				bins[index] = carry;
+				if (index > max_bin) { max_bin = index; }
+				current = next;
+			}
+
+			Node* sorted = nullptr;
+			for (int index = 0; index <= max_bin; ++index) {
+				if (bins[index] != nullptr) {
+					// bins[index] came earlier in the original list than everything merged so far,
+					// so it goes in as `first` to preserve stability
+					sorted = (sorted == nullptr) ? bins[index] : merge_nodes(bins[index], sorted);
+				}
+			}
+			relink_prev(sorted);
+		}
+
+		// Steals the nodes of `other` into this list, keeping the order - both lists must already
+		// be sorted. The node-stealing counterpart of splice(): O(n + m) relinks, no copies.
+		constexpr void merge(List& other) {
+			if (this == &other || other.m_head == nullptr) { return; }
+			if (m_head == nullptr) {
+				relink_prev(other.m_head);
+			}
+			else {
+				relink_prev(merge_nodes(m_head, other.m_head));
+			}
+			m_size += other.m_size;
+			other.m_head = nullptr;
+			other.m_tail = nullptr;
+			other.m_size = 0;
+			adopt_blocks(other);
+		}
 
 	private:
 		constexpr Node* _Remove(Node* beforeNode) noexcept {
 			if (beforeNode->next == m_tail) {
 				Node* temp_tail = m_tail;
 				m_tail = beforeNode;
-				delete temp_tail;
+				destroy_node(temp_tail);
 				m_tail->next = nullptr;
 				return nullptr;
 			}
@@ -512,7 +725,7 @@ namespace container {
 				const auto to_remove = beforeNode->next;
 				const auto removed_next = to_remove->next;
 				beforeNode->next = removed_next;
-				delete to_remove;
+				destroy_node(to_remove);
 				return removed_next;
 			}
 		}
@@ -524,7 +737,7 @@ namespace container {
 
 		template<typename Predicate>
 		constexpr size_type remove_if(Predicate pred) {
-			Node* before_begin = new Node();
+			Node* before_begin = create_node();
 			Node* tmp_before_begin = before_begin;
 			before_begin->next = m_head;
 			size_type tot_removed{ 0 };
@@ -545,6 +758,7 @@ namespace container {
 					first = first->next;
 				}
 			}
+			destroy_node(tmp_before_begin);	// The dummy head node; this used to leak
 			m_size -= tot_removed;
 			return tot_removed;
 		}
@@ -576,6 +790,9 @@ namespace container {
 			temp_tail = nullptr;
 
 			std::swap(m_size, other.m_size);
+			std::swap(m_free, other.m_free);	// The pools follow their allocators
+			std::swap(m_blocks, other.m_blocks);
+			std::swap(m_allocator, other.m_allocator);
 		}
 
 		// Overloaded comparision operators
@@ -618,4 +835,10 @@ namespace container {
 		}
 	};
 
+	namespace pmr {
+		template <class T>
+		using list = container::List<T, std::pmr::polymorphic_allocator<T>>;
+	}
+}
+
 #endif
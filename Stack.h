@@ -19,7 +19,7 @@ namespace container {
 		using reference = typename Container::reference;
 		using const_reference = typename Container::const_reference;
 		using size_type = typename Container::size_type;
-		using container_type = typename Container;
+		using container_type = Container;	// 'typename' here was an MSVC-ism other compilers reject
 
 		// Constructors
 		constexpr Stack() = default;
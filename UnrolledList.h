@@ -0,0 +1,459 @@
+#ifndef UNROLLED_LIST
+#define UNROLLED_LIST
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+/* Unrolled variant of container::List: every node carries a small fixed-capacity array of elements
+   instead of a single one, so the two link pointers are paid once per NodeCapacity elements rather
+   than once per element, and iteration walks contiguous slots inside each node - mostly sequential
+   cache lines instead of a guaranteed miss per element. Inserts and erases shift elements inside a
+   node; a full node is split in half and nodes that got sparse are merged with their successor, so
+   interior nodes stay at least half full. */
+
+namespace container {
+	template<typename Type, std::size_t NodeCapacity = 8, typename Allocator = std::allocator<Type>>
+	class UnrolledList {
+		static_assert(NodeCapacity >= 2, "error: a node must hold at least two elements");
+
+	private:
+		struct Node {
+			// Raw storage: only the first `count` slots hold live elements, so Type needs no
+			// default constructor and dead slots cost no destructor calls
+			alignas(Type) std::byte storage[NodeCapacity * sizeof(Type)];
+			Node* next = nullptr;
+			Node* prev = nullptr;
+			std::size_t count = 0;
+
+			Type* slot(std::size_t index) noexcept {
+				return reinterpret_cast<Type*>(storage) + index;
+			}
+
+			const Type* slot(std::size_t index) const noexcept {
+				return reinterpret_cast<const Type*>(storage) + index;
+			}
+		};
+
+		// Rebound to the node type so every chunk goes through allocator_traits, same scheme as
+		// List/ForwardList. The elements are built in place with construct_at/destroy_at.
+		using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+		using node_alloc_traits = std::allocator_traits<node_allocator>;
+
+		Node* m_head = nullptr;
+		Node* m_tail = nullptr;
+		std::size_t m_size = 0;
+		node_allocator m_allocator;
+
+		Node* create_node() {
+			Node* node = node_alloc_traits::allocate(m_allocator, 1);
+			node_alloc_traits::construct(m_allocator, node);
+			return node;
+		}
+
+		void destroy_node(Node* node) noexcept {
+			node_alloc_traits::destroy(m_allocator, node);
+			node_alloc_traits::deallocate(m_allocator, node, 1);
+		}
+
+		/* Bidirectional iterator: a node pointer plus the slot index inside it. end() is the
+		(nullptr, 0) iterator, like List's null end - decrementing it is not supported. */
+		template<typename T>
+		class BidirectionalIterator {
+		private:
+			Node* m_node;
+			std::size_t m_index;
+
+		public:
+			using value_type = T;
+			using reference = T&;
+			using pointer = value_type*;
+			using iterator_category = std::bidirectional_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+
+			BidirectionalIterator(Node* node = nullptr, std::size_t index = 0) noexcept
+				: m_node{ node }, m_index{ index } {}
+
+			Node* getNodeAddress() const noexcept { return m_node; }
+			std::size_t getNodeIndex() const noexcept { return m_index; }
+			reference operator*() const noexcept { return *m_node->slot(m_index); }
+			pointer operator->() const noexcept { return m_node->slot(m_index); }
+
+			BidirectionalIterator& operator++() noexcept {
+				++m_index;
+				if (m_index == m_node->count) {
+					m_node = m_node->next;
+					m_index = 0;
+				}
+				return *this;
+			}
+			BidirectionalIterator operator++(int) noexcept {
+				BidirectionalIterator tmp(*this);
+				++(*this);
+				return tmp;
+			}
+			BidirectionalIterator& operator--() noexcept {
+				if (m_index == 0) {
+					m_node = m_node->prev;
+					m_index = m_node->count - 1;
+				}
+				else {
+					--m_index;
+				}
+				return *this;
+			}
+			BidirectionalIterator operator--(int) noexcept {
+				BidirectionalIterator tmp(*this);
+				--(*this);
+				return tmp;
+			}
+			friend bool operator==(const BidirectionalIterator& first, const BidirectionalIterator& second) noexcept {
+				return first.m_node == second.m_node && first.m_index == second.m_index;
+			}
+			friend bool operator!=(const BidirectionalIterator& first, const BidirectionalIterator& second) noexcept {
+				return !(first == second);
+			}
+		};
+
+		void link_after(Node* node, Node* fresh) noexcept {
+			if (node == nullptr) {	// Empty list
+				m_head = fresh;
+				m_tail = fresh;
+				return;
+			}
+			fresh->prev = node;
+			fresh->next = node->next;
+			if (node->next != nullptr) { node->next->prev = fresh; }
+			else { m_tail = fresh; }
+			node->next = fresh;
+		}
+
+		void unlink(Node* node) noexcept {
+			if (node->prev != nullptr) { node->prev->next = node->next; }
+			else { m_head = node->next; }
+			if (node->next != nullptr) { node->next->prev = node->prev; }
+			else { m_tail = node->prev; }
+		}
+
+		// Splits a full node in half, moving the upper half into a fresh node right after it
+		Node* split(Node* node) {
+			Node* upper = create_node();
+			const std::size_t half = NodeCapacity / 2;
+			for (std::size_t index = half; index < node->count; ++index) {
+				std::construct_at(upper->slot(index - half), std::move(*node->slot(index)));
+				std::destroy_at(node->slot(index));
+			}
+			upper->count = node->count - half;
+			node->count = half;
+			link_after(node, upper);
+			return upper;
+		}
+
+		// Pulls the successor's elements into `node` when both halves fit in one chunk, so erase
+		// churn cannot degenerate the list into a chain of nearly empty nodes
+		void try_merge_next(Node* node) noexcept {
+			Node* next = node->next;
+			if (next == nullptr || node->count + next->count > NodeCapacity) { return; }
+			for (std::size_t index = 0; index < next->count; ++index) {
+				std::construct_at(node->slot(node->count + index), std::move(*next->slot(index)));
+				std::destroy_at(next->slot(index));
+			}
+			node->count += next->count;
+			unlink(next);
+			destroy_node(next);
+		}
+
+	public:
+		using value_type = Type;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = Type*;
+		using const_pointer = const Type*;
+		using iterator = BidirectionalIterator<value_type>;
+		using const_iterator = BidirectionalIterator<const Type>;
+		using allocator_type = Allocator;
+		using const_alloc_reference = const allocator_type&;
+
+		static constexpr size_type node_capacity = NodeCapacity;
+
+		// Member functions
+		UnrolledList() noexcept = default;
+
+		explicit UnrolledList(const_alloc_reference allocator) noexcept
+			: m_allocator{ allocator }
+		{}
+
+		explicit UnrolledList(size_type count, const_reference value, const_alloc_reference allocator = Allocator())
+			: m_allocator{ allocator } {
+			for (size_type index{ 0 }; index < count; ++index) {
+				push_back(value);
+			}
+		}
+
+		// Type must be DefaultConstructible
+		explicit UnrolledList(size_type count, const_alloc_reference allocator = Allocator())
+			: UnrolledList(count, Type{}, allocator)
+		{}
+
+		template<std::input_iterator input_iter>
+		UnrolledList(input_iter first, input_iter last, const_alloc_reference allocator = Allocator())
+			: m_allocator{ allocator } {
+			for (; first != last; ++first) {
+				push_back(*first);
+			}
+		}
+
+		UnrolledList(std::initializer_list<Type> list, const_alloc_reference allocator = Allocator())
+			: UnrolledList(std::begin(list), std::end(list), allocator)
+		{}
+
+		UnrolledList(const UnrolledList& other)
+			: m_allocator{ node_alloc_traits::select_on_container_copy_construction(other.m_allocator) } {
+			for (const auto& current : other) {
+				push_back(current);
+			}
+		}
+
+		UnrolledList(UnrolledList&& other) noexcept
+			: UnrolledList() {
+			other.swap(*this);
+		}
+
+		~UnrolledList() {
+			clear();
+		}
+
+		UnrolledList& operator=(const UnrolledList& other) {
+			UnrolledList temp(other);
+			temp.swap(*this);
+			return *this;
+		}
+
+		UnrolledList& operator=(UnrolledList&& other) noexcept {
+			other.swap(*this);
+			other.clear();
+			return *this;
+		}
+
+		UnrolledList& operator=(std::initializer_list<Type> list) {
+			UnrolledList temp{ list };
+			temp.swap(*this);
+			return *this;
+		}
+
+		allocator_type get_allocator() const noexcept {
+			return allocator_type(m_allocator);
+		}
+
+		// Element access
+		reference front() noexcept {
+			return *m_head->slot(0);
+		}
+
+		const_reference front() const noexcept {
+			return *m_head->slot(0);
+		}
+
+		reference back() noexcept {
+			return *m_tail->slot(m_tail->count - 1);
+		}
+
+		const_reference back() const noexcept {
+			return *m_tail->slot(m_tail->count - 1);
+		}
+
+		// Iterators
+		iterator begin() noexcept {
+			return iterator(m_head, 0);
+		}
+
+		const_iterator begin() const noexcept {
+			return const_iterator(m_head, 0);
+		}
+
+		const_iterator cbegin() const noexcept {
+			return const_iterator(m_head, 0);
+		}
+
+		iterator end() noexcept {
+			return iterator(nullptr, 0);
+		}
+
+		const_iterator end() const noexcept {
+			return const_iterator(nullptr, 0);
+		}
+
+		const_iterator cend() const noexcept {
+			return const_iterator(nullptr, 0);
+		}
+
+		// Capacity
+		bool empty() const noexcept {
+			return m_size == 0;
+		}
+
+		size_type size() const noexcept {
+			return m_size;
+		}
+
+		size_type max_size() const noexcept {
+			return std::numeric_limits<difference_type>::max();
+		}
+
+		// Modifiers
+		void clear() noexcept {
+			Node* current = m_head;
+			while (current != nullptr) {
+				Node* next = current->next;
+				for (std::size_t index = 0; index < current->count; ++index) {
+					std::destroy_at(current->slot(index));
+				}
+				destroy_node(current);
+				current = next;
+			}
+			m_head = nullptr;
+			m_tail = nullptr;
+			m_size = 0;
+		}
+
+		/* Inserts before `position`. Inside a node the elements after the slot shift right by one;
+		a full node is first split in half, so the shift never moves more than NodeCapacity - 1
+		elements and iterators into other nodes stay valid. */
+		template<typename...Args>
+		iterator emplace(iterator position, Args&&...args) {
+			Node* node = position.getNodeAddress();
+			size_type index = position.getNodeIndex();
+			if (node == nullptr) {	// end(): append
+				if (m_tail == nullptr || m_tail->count == NodeCapacity) {
+					link_after(m_tail, create_node());
+				}
+				node = m_tail;
+				index = node->count;
+			}
+			if (node->count == NodeCapacity) {
+				Node* upper = split(node);
+				if (index > node->count) {
+					index -= node->count;
+					node = upper;
+				}
+			}
+			if (index == node->count) {
+				std::construct_at(node->slot(index), std::forward<Args>(args)...);
+			}
+			else {
+				// The old last element moves into raw storage; the rest shift by assignment
+				std::construct_at(node->slot(node->count), std::move(*node->slot(node->count - 1)));
+				std::move_backward(node->slot(index), node->slot(node->count - 1), node->slot(node->count));
+				*node->slot(index) = Type(std::forward<Args>(args)...);
+			}
+			++node->count;
+			++m_size;
+			return iterator(node, index);
+		}
+
+		iterator insert(iterator position, const_reference value) {
+			return emplace(position, value);
+		}
+
+		iterator insert(iterator position, Type&& value) {
+			return emplace(position, std::move(value));
+		}
+
+		// Returns the iterator to the element after the erased one
+		iterator erase(iterator position) {
+			Node* node = position.getNodeAddress();
+			const size_type index = position.getNodeIndex();
+			std::move(node->slot(index + 1), node->slot(node->count), node->slot(index));
+			std::destroy_at(node->slot(node->count - 1));
+			--node->count;
+			--m_size;
+			if (node->count == 0) {
+				Node* next = node->next;
+				unlink(node);
+				destroy_node(node);
+				return (next != nullptr) ? iterator(next, 0) : end();
+			}
+			try_merge_next(node);
+			if (index == node->count) {
+				return (node->next != nullptr) ? iterator(node->next, 0) : end();
+			}
+			return iterator(node, index);
+		}
+
+		void push_back(const_reference value) {
+			emplace_back(value);
+		}
+
+		void push_back(Type&& value) {
+			emplace_back(std::move(value));
+		}
+
+		template<typename...Args>
+		reference emplace_back(Args&&...args) {
+			return *emplace(end(), std::forward<Args>(args)...);
+		}
+
+		void push_front(const_reference value) {
+			emplace(begin(), value);
+		}
+
+		void push_front(Type&& value) {
+			emplace(begin(), std::move(value));
+		}
+
+		void pop_back() {
+			erase(iterator(m_tail, m_tail->count - 1));
+		}
+
+		void pop_front() {
+			erase(begin());
+		}
+
+		void swap(UnrolledList& other) noexcept {
+			std::swap(m_head, other.m_head);
+			std::swap(m_tail, other.m_tail);
+			std::swap(m_size, other.m_size);
+			std::swap(m_allocator, other.m_allocator);
+		}
+
+		// Overloaded comparision operators
+		bool operator==(const UnrolledList& other) const {
+			if (m_size != other.m_size) { return false; }
+			return std::equal(begin(), end(), other.begin());
+		}
+
+		bool operator!=(const UnrolledList& other) const {
+			return !(*this == other);
+		}
+
+		bool operator<(const UnrolledList& other) const {
+			return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+		}
+
+		bool operator>(const UnrolledList& other) const {
+			return other < *this;
+		}
+
+		bool operator<=(const UnrolledList& other) const {
+			return !(other < *this);
+		}
+
+		bool operator>=(const UnrolledList& other) const {
+			return !(*this < other);
+		}
+	};
+
+	namespace pmr {
+		template <class T, std::size_t NodeCapacity = 8>
+		using unrolled_list = container::UnrolledList<T, NodeCapacity, std::pmr::polymorphic_allocator<T>>;
+	}
+}
+
+#endif
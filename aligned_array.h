@@ -0,0 +1,128 @@
+#ifndef ALIGNED_ARRAY_CONTAINER
+#define ALIGNED_ARRAY_CONTAINER
+
+#include <algorithm>
+#include <concepts>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+/* container::array with guaranteed storage alignment for SIMD kernels: the element buffer carries
+   alignas(Alignment) (default 64 - one full cache line, enough for AVX-512 and every narrower
+   width), data() is qualified with std::assume_aligned so the compiler may emit aligned loads and
+   stores, and fill/apply/transform are written as flat index loops over the aligned storage that
+   autovectorize cleanly. Drop-in replacement for container::array otherwise. */
+
+namespace container {
+	template<typename T, std::size_t arr_size, std::size_t Alignment = 64>
+	class aligned_array
+	{
+		// Aliases
+		using iterator			 = T*;
+		using const_iterator		 = const T*;
+		using reverse_iterator		 = std::reverse_iterator<iterator>;
+		using const_reverse_iterator 	 = std::reverse_iterator<const_iterator>;
+		using reference			 = T&;
+		using const_reference		 = const T&;
+		using size_type			 = std::size_t;
+		using value_type		 = T;
+		using pointer			 = T*;
+		using const_pointer		 = const T*;
+		static_assert(arr_size != 0, "error: array size cannot be 0");
+		static_assert(Alignment >= alignof(T), "error: Alignment weaker than what T requires");
+		static_assert((Alignment & (Alignment - 1)) == 0, "error: Alignment must be a power of two");
+
+	public:
+		alignas(Alignment) T m_array[arr_size];
+
+		// Access operators (No bound checking)
+		constexpr reference operator[](size_type index)			 { return m_array[index]; }
+		constexpr const_reference operator[](size_type index) const	 { return m_array[index]; }
+		constexpr reference back() noexcept				 { return *(end() - 1); }
+		constexpr const_reference back() const noexcept			 { return *(end() - 1); }
+		constexpr reference front() noexcept				 { return *(data()); }
+		constexpr const_reference front() const noexcept		 { return *(data()); }
+
+		// The alignment promise travels with the pointer: callers (and the optimizer) may use
+		// aligned vector loads on it directly
+		constexpr pointer data() noexcept				 { return std::assume_aligned<Alignment>(m_array); }
+		constexpr const_pointer data() const noexcept			 { return std::assume_aligned<Alignment>(m_array); }
+
+		// Access operators (With bound checking)
+		constexpr reference at(size_type index)
+		{
+			return (index < arr_size) ? m_array[index] : throw std::out_of_range("Error: Index out of range");
+		}
+		constexpr const_reference at(size_type index) const
+		{
+			return (index < arr_size) ? m_array[index] : throw std::out_of_range("Error: Index out of range");
+		}
+
+		// Size related
+		constexpr size_type size() const noexcept	 { return arr_size; }
+		constexpr size_type max_size() const noexcept	 { return arr_size; }
+		static constexpr size_type alignment() noexcept	 { return Alignment; }
+
+		// Bulk kernels. All of them run a flat index loop over assume_aligned storage - no early
+		// exits, no aliasing surprises - which is the shape the autovectorizer wants.
+		constexpr void fill(const T& value) noexcept
+		{
+			pointer aligned = data();
+			for (size_type index{ 0 }; index < arr_size; ++index) aligned[index] = value;
+		}
+
+		// Applies func elementwise in place: a[i] = func(a[i])
+		template<typename Func>
+		constexpr void apply(Func func) noexcept
+		{
+			pointer aligned = data();
+			for (size_type index{ 0 }; index < arr_size; ++index) aligned[index] = func(aligned[index]);
+		}
+
+		// out[i] = func(a[i]) into a fresh array, leaving this one untouched
+		template<typename Func>
+		constexpr aligned_array transform(Func func) const
+		{
+			aligned_array result;
+			const_pointer aligned = data();
+			pointer out = result.data();
+			for (size_type index{ 0 }; index < arr_size; ++index) out[index] = func(aligned[index]);
+			return result;
+		}
+
+		// out[i] = func(a[i], b[i]) - elementwise combine of two equally aligned arrays
+		template<typename Func>
+		constexpr aligned_array transform(const aligned_array& other, Func func) const
+		{
+			aligned_array result;
+			const_pointer aligned = data();
+			const_pointer other_aligned = other.data();
+			pointer out = result.data();
+			for (size_type index{ 0 }; index < arr_size; ++index) out[index] = func(aligned[index], other_aligned[index]);
+			return result;
+		}
+
+		void swap(aligned_array& other) noexcept	 { std::swap(m_array, other.m_array); }
+
+		// Iterators
+		constexpr iterator begin() noexcept			{ return m_array; }
+		constexpr const_iterator begin() const noexcept		{ return m_array; }
+		constexpr const_iterator cbegin() const noexcept        { return m_array; }
+		constexpr iterator end()   noexcept		        { return m_array + arr_size; }
+		constexpr const_iterator end() const noexcept	        { return m_array + arr_size; }
+		constexpr const_iterator cend() const noexcept	        { return m_array + arr_size; }
+		constexpr auto rbegin() noexcept		        { return reverse_iterator(end()); }
+		constexpr const auto rbegin() const noexcept	        { return const_reverse_iterator(end()); }
+		constexpr const auto crbegin() const noexcept	        { return const_reverse_iterator(end()); }
+		constexpr auto rend() noexcept				{ return reverse_iterator(begin()); }
+		constexpr const auto rend() const noexcept		{ return reverse_iterator(begin()); }
+		constexpr const auto crend() const noexcept		{ return reverse_iterator(begin()); }
+	};
+
+	// Deduction guide. Checks if the Arguments are of the same type as T.
+	template<typename T, std::same_as<T>...Args>
+	aligned_array(T, Args...)->aligned_array<T, sizeof...(Args) + 1>;
+}
+
+#endif
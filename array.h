@@ -52,7 +52,7 @@ namespace container {
 		constexpr size_type max_size() const noexcept	 { return arr_size; }
 
 		// Miscellaneous
-		void fill(const size_type& value) noexcept	 { for (auto& current : m_array) current = value; }
+		constexpr void fill(const T& value) noexcept	 { for (auto& current : m_array) current = value; }
 		void swap(array& other) noexcept		 { std::swap(m_array, other.m_array); }
 
 
@@ -0,0 +1,82 @@
+#ifndef CONTAINER_BENCH_HARNESS
+#define CONTAINER_BENCH_HARNESS
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+/* Tiny benchmark harness for the suites in this directory - no external dependency, so the target
+   builds anywhere the headers do. Each case is a lambda run once as warmup (page faults, cache
+   warmup, one-time growth) and then three measured times; the best repetition is reported as ns/op
+   together with the bytes and calls that went through the global operator new during it, which is
+   what the allocation column in the output means. Pass a substring as argv[1] to run only the
+   cases whose name contains it. */
+
+namespace bench {
+	// Fed by the global operator new/delete overrides in bench_main.cpp
+	extern std::size_t g_bytes_allocated;
+	extern std::size_t g_alloc_calls;
+
+	void set_filter(const char* filter);
+	bool name_matches(const char* name);
+
+	// Stops the optimizer from deleting a computation without generating any code itself
+	template<typename T>
+	inline void do_not_optimize(T& value) { asm volatile("" : "+m"(value) : : "memory"); }
+	inline void sink(std::uint64_t value) { asm volatile("" : : "r"(value) : "memory"); }
+
+	template<typename Fn>
+	void run(const char* name, std::size_t operations, Fn&& fn) {
+		if (!name_matches(name)) return;
+		fn();
+		double best_ns = 1e300;
+		std::size_t best_bytes = 0;
+		std::size_t best_calls = 0;
+		for (int repetition = 0; repetition < 3; ++repetition) {
+			const std::size_t bytes_before = g_bytes_allocated;
+			const std::size_t calls_before = g_alloc_calls;
+			const auto start = std::chrono::steady_clock::now();
+			fn();
+			const auto stop = std::chrono::steady_clock::now();
+			const double ns = std::chrono::duration<double, std::nano>(stop - start).count()
+				/ static_cast<double>(operations);
+			if (ns < best_ns) {
+				best_ns = ns;
+				best_bytes = g_bytes_allocated - bytes_before;
+				best_calls = g_alloc_calls - calls_before;
+			}
+		}
+		std::printf("%-52s %10.1f ns/op %14zu bytes %10zu allocs\n", name, best_ns, best_bytes, best_calls);
+	}
+
+	// 64-byte element for the "big element" parameterization of each suite
+	struct payload {
+		std::uint64_t key;
+		std::uint64_t pad[7];
+		payload(std::uint64_t k = 0) : key{ k }, pad{} {}
+		bool operator<(const payload& other) const { return key < other.key; }
+		bool operator==(const payload& other) const { return key == other.key; }
+	};
+	static_assert(sizeof(payload) == 64);
+
+	// Deterministic xorshift so every run and every container sees the same key stream
+	struct rng {
+		std::uint64_t state = 0x9e3779b97f4a7c15ull;
+		std::uint64_t next() {
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			return state;
+		}
+	};
+
+	// Suites (one translation unit each)
+	void run_vector_suite();
+	void run_hashtable_suite();
+	void run_avl_suite();
+	void run_lists_suite();
+	void run_adaptors_suite();
+}
+
+#endif
@@ -0,0 +1,74 @@
+#include "bench.h"
+#include "Queue.h"
+#include "ring_buffer.h"
+#include "Stack.h"
+#include "vector.h"
+
+#include <deque>
+#include <queue>
+#include <stack>
+
+/* Queue and Stack across backends: fill-then-drain and a steady-state cycle through a pre-warmed
+   adaptor (the pattern a scheduler or BFS actually runs, where the ring_buffer backend should
+   never allocate). */
+
+namespace {
+	template<typename QueueType>
+	void queue_fill_drain_case(const char* name, std::size_t count) {
+		bench::run(name, count, [count] {
+			QueueType queue;
+			for (std::size_t index = 0; index < count; ++index) queue.push(static_cast<int>(index));
+			std::uint64_t sum = 0;
+			while (!queue.empty()) {
+				sum += static_cast<std::uint64_t>(queue.front());
+				queue.pop();
+			}
+			bench::sink(sum);
+		});
+	}
+
+	template<typename QueueType>
+	void queue_cycle_case(const char* name, std::size_t count) {
+		bench::run(name, count, [count] {
+			QueueType queue;
+			for (int index = 0; index < 64; ++index) queue.push(index);	// warm backlog
+			std::uint64_t sum = 0;
+			for (std::size_t index = 0; index < count; ++index) {
+				queue.push(static_cast<int>(index));
+				sum += static_cast<std::uint64_t>(queue.front());
+				queue.pop();
+			}
+			bench::sink(sum);
+		});
+	}
+
+	template<typename StackType>
+	void stack_case(const char* name, std::size_t count) {
+		bench::run(name, count, [count] {
+			StackType stack;
+			for (std::size_t index = 0; index < count; ++index) stack.push(static_cast<int>(index));
+			std::uint64_t sum = 0;
+			while (!stack.empty()) {
+				sum += static_cast<std::uint64_t>(stack.top());
+				stack.pop();
+			}
+			bench::sink(sum);
+		});
+	}
+}
+
+void bench::run_adaptors_suite() {
+	constexpr std::size_t count = 1000000;
+
+	queue_fill_drain_case<container::Queue<int, container::ring_buffer<int>>>("Queue<ring_buffer>/fill_drain/1M", count);
+	queue_fill_drain_case<container::Queue<int, std::deque<int>>>("Queue<std::deque>/fill_drain/1M", count);
+	queue_fill_drain_case<std::queue<int>>("std::queue<std::deque>/fill_drain/1M", count);
+
+	queue_cycle_case<container::Queue<int, container::ring_buffer<int>>>("Queue<ring_buffer>/cycle/1M", count);
+	queue_cycle_case<container::Queue<int, std::deque<int>>>("Queue<std::deque>/cycle/1M", count);
+	queue_cycle_case<std::queue<int>>("std::queue<std::deque>/cycle/1M", count);
+
+	stack_case<container::Stack<int, container::vector<int>>>("Stack<vector>/fill_drain/1M", count);
+	stack_case<container::Stack<int, std::deque<int>>>("Stack<std::deque>/fill_drain/1M", count);
+	stack_case<std::stack<int, std::vector<int>>>("std::stack<std::vector>/fill_drain/1M", count);
+}
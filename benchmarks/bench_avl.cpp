@@ -0,0 +1,88 @@
+#include "bench.h"
+#include "AVL_Tree.h"
+
+#include <set>
+#include <vector>
+
+/* AVL vs std::set (the red-black tree it competes with): random insert, hit lookups, and an
+   in-order range scan between two bounds - the access pattern ordered indexes exist for. */
+
+namespace {
+	std::vector<int> make_keys(std::size_t count) {
+		std::vector<int> keys;
+		keys.reserve(count);
+		bench::rng random;
+		for (std::size_t index = 0; index < count; ++index) {
+			keys.push_back(static_cast<int>(random.next() >> 33));
+		}
+		return keys;
+	}
+}
+
+void bench::run_avl_suite() {
+	constexpr std::size_t count = 100000;
+	const std::vector<int> keys = make_keys(count);
+
+	bench::run("AVL<int>/insert/100k", count, [&keys] {
+		container::AVL<int> tree;
+		for (const int key : keys) tree.insert(key);
+		bench::do_not_optimize(tree);
+	});
+	bench::run("std::set<int>/insert/100k", count, [&keys] {
+		std::set<int> tree;
+		for (const int key : keys) tree.insert(key);
+		bench::do_not_optimize(tree);
+	});
+
+	{
+		container::AVL<int> tree;
+		std::set<int> standard;
+		for (const int key : keys) {
+			tree.insert(key);
+			standard.insert(key);
+		}
+		bench::run("AVL<int>/contains_hit/100k", count, [&] {
+			std::uint64_t hits = 0;
+			for (const int key : keys) hits += tree.contains(key) ? 1 : 0;
+			bench::sink(hits);
+		});
+		bench::run("std::set<int>/contains_hit/100k", count, [&] {
+			std::uint64_t hits = 0;
+			for (const int key : keys) hits += standard.contains(key) ? 1 : 0;
+			bench::sink(hits);
+		});
+
+		const int low = keys[count / 4];
+		const int high = keys[count / 4] + (1 << 24);
+		bench::run("AVL<int>/range_scan/100k", count, [&] {
+			std::uint64_t sum = 0;
+			for (auto it = tree.lower_bound(low), last = tree.upper_bound(high); it != last; ++it) {
+				sum += static_cast<std::uint64_t>(*it);
+			}
+			bench::sink(sum);
+		});
+		bench::run("std::set<int>/range_scan/100k", count, [&] {
+			std::uint64_t sum = 0;
+			for (auto it = standard.lower_bound(low), last = standard.upper_bound(high); it != last; ++it) {
+				sum += static_cast<std::uint64_t>(*it);
+			}
+			bench::sink(sum);
+		});
+	}
+
+	// Sorted bulk build vs element-wise insert of the same sorted data
+	{
+		std::vector<int> sorted = keys;
+		std::sort(sorted.begin(), sorted.end());
+		sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+		bench::run("AVL<int>/from_sorted/100k", sorted.size(), [&sorted] {
+			auto tree = container::AVL<int>::from_sorted(sorted.begin(), sorted.end());
+			bench::do_not_optimize(tree);
+		});
+		bench::run("AVL<int>/insert_sorted/100k", sorted.size(), [&sorted] {
+			container::AVL<int> tree;
+			for (const int key : sorted) tree.insert(key);
+			bench::do_not_optimize(tree);
+		});
+	}
+}
@@ -0,0 +1,160 @@
+#include "bench.h"
+#include "FlatHashTable.h"
+#include "HashTable.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* HashTable and FlatHashTable vs std::unordered_map: growth-driven insert (which is where rehash
+   cost shows up), reserved insert, hit and miss lookups, int and string keys, and insert across
+   load factors - a low factor trades memory for fewer collisions and more rehashes. Hit keys are
+   even and miss keys odd, so the two streams never overlap. */
+
+namespace {
+	std::vector<int> make_keys(std::size_t count) {
+		std::vector<int> keys;
+		keys.reserve(count);
+		bench::rng random;
+		for (std::size_t index = 0; index < count; ++index) {
+			keys.push_back(static_cast<int>(random.next() >> 34) << 1);
+		}
+		return keys;
+	}
+
+	std::vector<std::string> make_string_keys(const std::vector<int>& keys) {
+		std::vector<std::string> string_keys;
+		string_keys.reserve(keys.size());
+		for (const int key : keys) string_keys.push_back("config/key/" + std::to_string(key));
+		return string_keys;
+	}
+}
+
+void bench::run_hashtable_suite() {
+	constexpr std::size_t count = 200000;
+	const std::vector<int> keys = make_keys(count);
+	const std::vector<std::string> string_keys = make_string_keys(keys);
+
+	// Insert, growth included
+	bench::run("HashTable<int,int>/insert/200k", count, [&keys] {
+		container::HashTable<int, int> table;
+		for (const int key : keys) table.emplace(key, key);
+		bench::do_not_optimize(table);
+	});
+	bench::run("FlatHashTable<int,int>/insert/200k", count, [&keys] {
+		container::FlatHashTable<int, int> table;
+		for (const int key : keys) table.emplace(key, key);
+		bench::do_not_optimize(table);
+	});
+	bench::run("std::unordered_map<int,int>/insert/200k", count, [&keys] {
+		std::unordered_map<int, int> table;
+		for (const int key : keys) table.emplace(key, key);
+		bench::do_not_optimize(table);
+	});
+
+	// Insert with reserve: isolates per-element cost from rehashing
+	bench::run("HashTable<int,int>/insert_reserved/200k", count, [&keys] {
+		container::HashTable<int, int> table;
+		table.reserve(count);
+		for (const int key : keys) table.emplace(key, key);
+		bench::do_not_optimize(table);
+	});
+	bench::run("FlatHashTable<int,int>/insert_reserved/200k", count, [&keys] {
+		container::FlatHashTable<int, int> table;
+		table.reserve(count);
+		for (const int key : keys) table.emplace(key, key);
+		bench::do_not_optimize(table);
+	});
+	bench::run("std::unordered_map<int,int>/insert_reserved/200k", count, [&keys] {
+		std::unordered_map<int, int> table;
+		table.reserve(count);
+		for (const int key : keys) table.emplace(key, key);
+		bench::do_not_optimize(table);
+	});
+
+	// Insert across load factors: more headroom means fewer rehashes but a larger, colder table
+	bench::run("HashTable<int,int>/insert_load_0.5/200k", count, [&keys] {
+		container::HashTable<int, int> table;
+		table.max_load_factor(0.5);
+		for (const int key : keys) table.emplace(key, key);
+		bench::do_not_optimize(table);
+	});
+	bench::run("std::unordered_map<int,int>/insert_load_0.5/200k", count, [&keys] {
+		std::unordered_map<int, int> table;
+		table.max_load_factor(0.5f);
+		for (const int key : keys) table.emplace(key, key);
+		bench::do_not_optimize(table);
+	});
+
+	// Lookups over tables built once outside the timed region
+	{
+		container::HashTable<int, int> table;
+		container::FlatHashTable<int, int> flat;
+		std::unordered_map<int, int> standard;
+		for (const int key : keys) {
+			table.emplace(key, key);
+			flat.emplace(key, key);
+			standard.emplace(key, key);
+		}
+		bench::run("HashTable<int,int>/find_hit/200k", count, [&] {
+			std::uint64_t sum = 0;
+			for (const int key : keys) sum += static_cast<std::uint64_t>(table.find(key)->second);
+			bench::sink(sum);
+		});
+		bench::run("FlatHashTable<int,int>/find_hit/200k", count, [&] {
+			std::uint64_t sum = 0;
+			for (const int key : keys) sum += static_cast<std::uint64_t>(flat.at(key));
+			bench::sink(sum);
+		});
+		bench::run("std::unordered_map<int,int>/find_hit/200k", count, [&] {
+			std::uint64_t sum = 0;
+			for (const int key : keys) sum += static_cast<std::uint64_t>(standard.find(key)->second);
+			bench::sink(sum);
+		});
+		bench::run("HashTable<int,int>/find_miss/200k", count, [&] {
+			std::uint64_t misses = 0;
+			for (const int key : keys) misses += table.contains_key(key | 1) ? 0 : 1;
+			bench::sink(misses);
+		});
+		bench::run("FlatHashTable<int,int>/find_miss/200k", count, [&] {
+			std::uint64_t misses = 0;
+			for (const int key : keys) misses += flat.contains_key(key | 1) ? 0 : 1;
+			bench::sink(misses);
+		});
+		bench::run("std::unordered_map<int,int>/find_miss/200k", count, [&] {
+			std::uint64_t misses = 0;
+			for (const int key : keys) misses += standard.contains(key | 1) ? 0 : 1;
+			bench::sink(misses);
+		});
+	}
+
+	// String keys: hashing cost dominates, probe layout matters less
+	bench::run("HashTable<string,int>/insert/200k", count, [&string_keys] {
+		container::HashTable<std::string, int> table;
+		for (const auto& key : string_keys) table.emplace(key, 1);
+		bench::do_not_optimize(table);
+	});
+	bench::run("std::unordered_map<string,int>/insert/200k", count, [&string_keys] {
+		std::unordered_map<std::string, int> table;
+		for (const auto& key : string_keys) table.emplace(key, 1);
+		bench::do_not_optimize(table);
+	});
+	{
+		container::HashTable<std::string, int> table;
+		std::unordered_map<std::string, int> standard;
+		for (const auto& key : string_keys) {
+			table.emplace(key, 1);
+			standard.emplace(key, 1);
+		}
+		bench::run("HashTable<string,int>/find_hit/200k", count, [&] {
+			std::uint64_t sum = 0;
+			for (const auto& key : string_keys) sum += static_cast<std::uint64_t>(table.find(key)->second);
+			bench::sink(sum);
+		});
+		bench::run("std::unordered_map<string,int>/find_hit/200k", count, [&] {
+			std::uint64_t sum = 0;
+			for (const auto& key : string_keys) sum += static_cast<std::uint64_t>(standard.find(key)->second);
+			bench::sink(sum);
+		});
+	}
+}
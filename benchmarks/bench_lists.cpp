@@ -0,0 +1,115 @@
+#include "bench.h"
+#include "ForwardList.h"
+#include "List.h"
+
+#include <forward_list>
+#include <list>
+#include <vector>
+
+/* List vs std::list and ForwardList vs std::forward_list: append/prepend (where the node pools
+   and block allocation show up in the allocs column), sort on random data, merge of two sorted
+   lists, splice, and remove-by-value. */
+
+namespace {
+	std::vector<int> make_values(std::size_t count) {
+		std::vector<int> values;
+		values.reserve(count);
+		bench::rng random;
+		for (std::size_t index = 0; index < count; ++index) {
+			values.push_back(static_cast<int>(random.next() >> 33));
+		}
+		return values;
+	}
+}
+
+void bench::run_lists_suite() {
+	constexpr std::size_t count = 100000;
+	const std::vector<int> values = make_values(count);
+
+	bench::run("List<int>/push_back/100k", count, [&values] {
+		container::List<int> list;
+		for (const int value : values) list.push_back(value);
+		bench::do_not_optimize(list);
+	});
+	bench::run("std::list<int>/push_back/100k", count, [&values] {
+		std::list<int> list;
+		for (const int value : values) list.push_back(value);
+		bench::do_not_optimize(list);
+	});
+	bench::run("ForwardList<int>/push_front/100k", count, [&values] {
+		container::ForwardList<int> list;
+		for (const int value : values) list.push_front(value);
+		bench::do_not_optimize(list);
+	});
+	bench::run("std::forward_list<int>/push_front/100k", count, [&values] {
+		std::forward_list<int> list;
+		for (const int value : values) list.push_front(value);
+		bench::do_not_optimize(list);
+	});
+
+	bench::run("List<int>/sort/100k", count, [&values] {
+		container::List<int> list(values.begin(), values.end());
+		list.sort();
+		bench::do_not_optimize(list);
+	});
+	bench::run("std::list<int>/sort/100k", count, [&values] {
+		std::list<int> list(values.begin(), values.end());
+		list.sort();
+		bench::do_not_optimize(list);
+	});
+	bench::run("ForwardList<int>/sort/100k", count, [&values] {
+		container::ForwardList<int> list(values.begin(), values.end());
+		list.sort();
+		bench::do_not_optimize(list);
+	});
+	bench::run("std::forward_list<int>/sort/100k", count, [&values] {
+		std::forward_list<int> list(values.begin(), values.end());
+		list.sort();
+		bench::do_not_optimize(list);
+	});
+
+	// Merge of two sorted halves; build cost is identical on both sides so the delta is the merge
+	{
+		std::vector<int> sorted = values;
+		std::sort(sorted.begin(), sorted.end());
+		bench::run("List<int>/build_and_merge/100k", count, [&sorted] {
+			container::List<int> left(sorted.begin(), sorted.begin() + sorted.size() / 2);
+			container::List<int> right(sorted.begin() + sorted.size() / 2, sorted.end());
+			left.merge(right);
+			bench::do_not_optimize(left);
+		});
+		bench::run("std::list<int>/build_and_merge/100k", count, [&sorted] {
+			std::list<int> left(sorted.begin(), sorted.begin() + sorted.size() / 2);
+			std::list<int> right(sorted.begin() + sorted.size() / 2, sorted.end());
+			left.merge(right);
+			bench::do_not_optimize(left);
+		});
+	}
+
+	// Splice is O(1); the build is timed too, identically on both sides
+	bench::run("List<int>/build_and_splice/100k", count, [&values] {
+		container::List<int> left(values.begin(), values.begin() + values.size() / 2);
+		container::List<int> right(values.begin() + values.size() / 2, values.end());
+		left.splice(left.begin(), right);
+		bench::do_not_optimize(left);
+	});
+	bench::run("std::list<int>/build_and_splice/100k", count, [&values] {
+		std::list<int> left(values.begin(), values.begin() + values.size() / 2);
+		std::list<int> right(values.begin() + values.size() / 2, values.end());
+		left.splice(left.begin(), right);
+		bench::do_not_optimize(left);
+	});
+
+	bench::run("List<int>/remove/100k", count, [&values] {
+		container::List<int> list(values.begin(), values.end());
+		list.remove(values[0]);
+		list.remove(values[count / 2]);
+		bench::do_not_optimize(list);
+	});
+	bench::run("std::list<int>/remove/100k", count, [&values] {
+		std::list<int> list(values.begin(), values.end());
+		list.remove(values[0]);
+		list.remove(values[count / 2]);
+		bench::do_not_optimize(list);
+	});
+}
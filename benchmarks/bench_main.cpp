@@ -0,0 +1,60 @@
+#include "bench.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace bench {
+	std::size_t g_bytes_allocated = 0;
+	std::size_t g_alloc_calls = 0;
+
+	namespace {
+		const char* g_filter = nullptr;
+	}
+
+	void set_filter(const char* filter) {
+		g_filter = filter;
+	}
+
+	bool name_matches(const char* name) {
+		return g_filter == nullptr || std::strstr(name, g_filter) != nullptr;
+	}
+}
+
+/* Counting overrides: every allocation in the process funnels through here, so the bytes column
+   covers the containers' own nodes and buffers as well as anything std counterparts do internally.
+   Single-threaded on purpose - the concurrent containers have their own smoke setups and atomics
+   here would perturb exactly what we measure. */
+void* operator new(std::size_t size) {
+	bench::g_bytes_allocated += size;
+	++bench::g_alloc_calls;
+	if (void* pointer = std::malloc(size)) return pointer;
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+	bench::g_bytes_allocated += size;
+	++bench::g_alloc_calls;
+	// aligned_alloc requires the size to be a multiple of the alignment; glibc forgives
+	// violations, other implementations return nullptr
+	const std::size_t raw_alignment = static_cast<std::size_t>(alignment);
+	const std::size_t rounded_size = (size + raw_alignment - 1) / raw_alignment * raw_alignment;
+	if (void* pointer = std::aligned_alloc(raw_alignment, rounded_size)) return pointer;
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t, std::size_t) noexcept { std::free(pointer); }
+
+int main(int argc, char** argv) {
+	if (argc > 1) bench::set_filter(argv[1]);
+	std::printf("%-52s %13s %20s %17s\n", "benchmark", "time", "allocated", "calls");
+	bench::run_vector_suite();
+	bench::run_hashtable_suite();
+	bench::run_avl_suite();
+	bench::run_lists_suite();
+	bench::run_adaptors_suite();
+}
@@ -0,0 +1,90 @@
+#include "bench.h"
+#include "vector.h"
+
+#include <vector>
+
+/* container::vector vs std::vector: append, middle insertion, front erasure and range
+   construction, over a small element (int) and a cache-line one (bench::payload). */
+
+namespace {
+	template<typename Vec>
+	void push_back_case(const char* name, std::size_t count) {
+		bench::run(name, count, [count] {
+			Vec vec;
+			for (std::size_t index = 0; index < count; ++index) {
+				vec.push_back(typename Vec::value_type(index));
+			}
+			bench::do_not_optimize(vec);
+		});
+	}
+
+	template<typename Vec>
+	void push_back_reserved_case(const char* name, std::size_t count) {
+		bench::run(name, count, [count] {
+			Vec vec;
+			vec.reserve(count);
+			for (std::size_t index = 0; index < count; ++index) {
+				vec.push_back(typename Vec::value_type(index));
+			}
+			bench::do_not_optimize(vec);
+		});
+	}
+
+	template<typename Vec>
+	void insert_middle_case(const char* name, std::size_t count) {
+		bench::run(name, count, [count] {
+			Vec vec;
+			for (std::size_t index = 0; index < count; ++index) {
+				vec.insert(vec.begin() + static_cast<std::ptrdiff_t>(vec.size() / 2),
+					typename Vec::value_type(index));
+			}
+			bench::do_not_optimize(vec);
+		});
+	}
+
+	template<typename Vec>
+	void erase_front_case(const char* name, std::size_t count) {
+		bench::run(name, count, [count] {
+			Vec vec;
+			for (std::size_t index = 0; index < count; ++index) {
+				vec.push_back(typename Vec::value_type(index));
+			}
+			while (!vec.empty()) {
+				vec.erase(vec.begin());
+			}
+			bench::do_not_optimize(vec);
+		});
+	}
+
+	template<typename Vec>
+	void range_construct_case(const char* name, const std::vector<int>& source) {
+		bench::run(name, source.size(), [&source] {
+			Vec vec(source.begin(), source.end());
+			bench::do_not_optimize(vec);
+		});
+	}
+}
+
+void bench::run_vector_suite() {
+	constexpr std::size_t big = 1000000;
+	constexpr std::size_t medium = 100000;
+	constexpr std::size_t quadratic = 10000;	// insert-middle and erase-front are O(n) per op
+
+	push_back_case<container::vector<int>>("vector<int>/push_back/1M", big);
+	push_back_case<std::vector<int>>("std::vector<int>/push_back/1M", big);
+	push_back_reserved_case<container::vector<int>>("vector<int>/push_back_reserved/1M", big);
+	push_back_reserved_case<std::vector<int>>("std::vector<int>/push_back_reserved/1M", big);
+	push_back_case<container::vector<bench::payload>>("vector<payload64>/push_back/100k", medium);
+	push_back_case<std::vector<bench::payload>>("std::vector<payload64>/push_back/100k", medium);
+
+	insert_middle_case<container::vector<int>>("vector<int>/insert_middle/10k", quadratic);
+	insert_middle_case<std::vector<int>>("std::vector<int>/insert_middle/10k", quadratic);
+
+	erase_front_case<container::vector<int>>("vector<int>/erase_front/10k", quadratic);
+	erase_front_case<std::vector<int>>("std::vector<int>/erase_front/10k", quadratic);
+
+	std::vector<int> source(big);
+	for (std::size_t index = 0; index < big; ++index) source[index] = static_cast<int>(index);
+	range_construct_case<container::vector<int>>("vector<int>/range_construct/1M", source);
+	range_construct_case<std::vector<int>>("std::vector<int>/range_construct/1M", source);
+}
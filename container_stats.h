@@ -0,0 +1,55 @@
+#ifndef CONTAINER_STATS_HEADER
+#define CONTAINER_STATS_HEADER
+
+#include <cstddef>
+
+/* Opt-in instrumentation for the containers: compile with -DCONTAINER_INSTRUMENTATION and each
+   container counts its slow-path events (reallocations, rehashes, rotations, node allocations...)
+   into a plain struct reachable through its stats() accessor - read it from a metrics pipeline or
+   printf it when production misbehaves. Without the define everything collapses: the structs below
+   become empty, they sit in the containers as [[no_unique_address]] members occupying no storage,
+   and every CONTAINER_STATS(...) update site disappears in the preprocessor, so the shipping build
+   pays nothing. The counters are per container instance and not atomic - sample them from the
+   thread that owns the container. */
+
+#ifdef CONTAINER_INSTRUMENTATION
+#define CONTAINER_STATS(expression) expression
+#else
+#define CONTAINER_STATS(expression)
+#endif
+
+namespace container {
+#ifdef CONTAINER_INSTRUMENTATION
+	struct vector_stats {
+		std::size_t reallocations = 0;			// All growth/shrink paths
+		std::size_t strong_guarantee_reallocations = 0;	// The subset going through reallocate_strong_guarantee()
+		std::size_t bytes_moved = 0;			// Payload relocated across those reallocations
+	};
+
+	struct hash_table_stats {
+		std::size_t rehashes = 0;
+		std::size_t collisions = 0;		// Insertions that landed in a non-empty bucket
+		std::size_t probe_steps = 0;		// Chain nodes walked during lookups and inserts
+		std::size_t max_chain_length = 0;	// Longest bucket ever inserted into
+	};
+
+	struct avl_stats {
+		std::size_t rotations_left = 0;
+		std::size_t rotations_right = 0;	// A double rotation counts one of each
+	};
+
+	struct list_stats {
+		std::size_t nodes_allocated = 0;	// Through the allocator (individually or carved from a Block)
+		std::size_t nodes_reused = 0;		// Served from the freelist instead
+		std::size_t nodes_freed = 0;		// Recycled onto the freelist
+		std::size_t blocks_allocated = 0;	// Contiguous 256-node Blocks from bulk construction
+	};
+#else
+	struct vector_stats {};
+	struct hash_table_stats {};
+	struct avl_stats {};
+	struct list_stats {};
+#endif
+}
+
+#endif
@@ -0,0 +1,240 @@
+#ifndef RING_BUFFER_CONTAINER
+#define RING_BUFFER_CONTAINER
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+/* Contiguous circular buffer, meant as a drop-in backend for container::Queue in place of
+   std::deque: one allocation holds the whole queue, the capacity is kept at a power of two so the
+   head/tail indices wrap with a mask instead of a modulo, and at steady occupancy a push/pop cycle
+   is two index updates with zero allocator traffic. When a push finds the buffer full the storage
+   doubles and the elements are relinearized from slot 0. */
+
+namespace container {
+	template<typename T, typename Allocator = std::allocator<T>>
+	class ring_buffer {
+	public:
+		using value_type = T;
+		using allocator_type = Allocator;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using const_alloc_reference = const allocator_type&;
+
+	private:
+		inline static constexpr size_type min_capacity = 8;
+
+		T* m_data = nullptr;
+		size_type m_capacity = 0;	// Always zero or a power of two
+		size_type m_head = 0;		// Index of the oldest element
+		size_type m_size = 0;
+		[[no_unique_address]] allocator_type m_allocator{};
+
+		// The wrap: with a power-of-two capacity the modulo collapses to one AND
+		constexpr size_type wrap(size_type index) const noexcept {
+			return index & (m_capacity - 1);
+		}
+
+		constexpr T* slot(size_type index) noexcept {
+			return m_data + wrap(m_head + index);
+		}
+
+		constexpr const T* slot(size_type index) const noexcept {
+			return m_data + wrap(m_head + index);
+		}
+
+		// Moves everything into a buffer of `new_capacity` (a power of two), relinearized from
+		// slot 0 so the next wraparound is as far away as possible
+		constexpr void regrow(size_type new_capacity) {
+			T* fresh = std::allocator_traits<Allocator>::allocate(m_allocator, new_capacity);
+			for (size_type index{ 0 }; index < m_size; ++index) {
+				std::construct_at(fresh + index, std::move(*slot(index)));
+				std::destroy_at(slot(index));
+			}
+			if (m_data != nullptr) {
+				std::allocator_traits<Allocator>::deallocate(m_allocator, m_data, m_capacity);
+			}
+			m_data = fresh;
+			m_capacity = new_capacity;
+			m_head = 0;
+		}
+
+	public:
+		// Constructors, destructor, assignment
+		constexpr ring_buffer() noexcept = default;
+
+		constexpr explicit ring_buffer(const_alloc_reference allocator) noexcept
+			: m_allocator{ allocator }
+		{}
+
+		constexpr explicit ring_buffer(size_type capacity, const_alloc_reference allocator = Allocator())
+			: m_allocator{ allocator } {
+			reserve(capacity);
+		}
+
+		constexpr ring_buffer(std::initializer_list<T> list, const_alloc_reference allocator = Allocator())
+			: m_allocator{ allocator } {
+			reserve(list.size());
+			for (const auto& current : list) {
+				push_back(current);
+			}
+		}
+
+		constexpr ring_buffer(const ring_buffer& other)
+			: m_allocator{ std::allocator_traits<Allocator>::select_on_container_copy_construction(other.m_allocator) } {
+			reserve(other.m_size);
+			for (size_type index{ 0 }; index < other.m_size; ++index) {
+				push_back(other[index]);
+			}
+		}
+
+		constexpr ring_buffer(ring_buffer&& other) noexcept
+			: ring_buffer() {
+			other.swap(*this);
+		}
+
+		constexpr ~ring_buffer() {
+			clear();
+			if (m_data != nullptr) {
+				std::allocator_traits<Allocator>::deallocate(m_allocator, m_data, m_capacity);
+			}
+		}
+
+		constexpr ring_buffer& operator=(const ring_buffer& other) {
+			ring_buffer temp(other);
+			temp.swap(*this);
+			return *this;
+		}
+
+		constexpr ring_buffer& operator=(ring_buffer&& other) noexcept {
+			other.swap(*this);
+			return *this;
+		}
+
+		constexpr allocator_type get_allocator() const noexcept {
+			return m_allocator;
+		}
+
+		// Element access. Index 0 is the oldest element, like a deque's front.
+		constexpr reference operator[](size_type index) noexcept {
+			return *slot(index);
+		}
+
+		constexpr const_reference operator[](size_type index) const noexcept {
+			return *slot(index);
+		}
+
+		constexpr reference front() noexcept {
+			return *slot(0);
+		}
+
+		constexpr const_reference front() const noexcept {
+			return *slot(0);
+		}
+
+		constexpr reference back() noexcept {
+			return *slot(m_size - 1);
+		}
+
+		constexpr const_reference back() const noexcept {
+			return *slot(m_size - 1);
+		}
+
+		// Capacity
+		constexpr bool empty() const noexcept {
+			return m_size == 0;
+		}
+
+		constexpr size_type size() const noexcept {
+			return m_size;
+		}
+
+		constexpr size_type capacity() const noexcept {
+			return m_capacity;
+		}
+
+		constexpr void reserve(size_type count) {
+			if (count > m_capacity) {
+				regrow(std::bit_ceil(std::max(count, min_capacity)));
+			}
+		}
+
+		// Modifiers
+		constexpr void clear() noexcept {
+			for (size_type index{ 0 }; index < m_size; ++index) {
+				std::destroy_at(slot(index));
+			}
+			m_head = 0;
+			m_size = 0;
+		}
+
+		template<typename...Args>
+		constexpr reference emplace_back(Args&&...args) {
+			if (m_size == m_capacity) {
+				regrow(m_capacity == 0 ? min_capacity : m_capacity * 2);
+			}
+			T* added = m_data + wrap(m_head + m_size);
+			std::construct_at(added, std::forward<Args>(args)...);
+			++m_size;
+			return *added;
+		}
+
+		constexpr void push_back(const_reference value) {
+			emplace_back(value);
+		}
+
+		constexpr void push_back(T&& value) {
+			emplace_back(std::move(value));
+		}
+
+		constexpr void pop_front() noexcept {
+			assert(m_size != 0 && "pop_front on an empty ring_buffer");
+			std::destroy_at(m_data + m_head);
+			m_head = wrap(m_head + 1);
+			--m_size;
+		}
+
+		constexpr void pop_back() noexcept {
+			assert(m_size != 0 && "pop_back on an empty ring_buffer");
+			std::destroy_at(slot(m_size - 1));
+			--m_size;
+		}
+
+		constexpr void swap(ring_buffer& other) noexcept {
+			std::swap(m_data, other.m_data);
+			std::swap(m_capacity, other.m_capacity);
+			std::swap(m_head, other.m_head);
+			std::swap(m_size, other.m_size);
+			std::swap(m_allocator, other.m_allocator);
+		}
+
+		// Overloaded comparision operators
+		constexpr bool operator==(const ring_buffer& other) const {
+			if (m_size != other.m_size) { return false; }
+			for (size_type index{ 0 }; index < m_size; ++index) {
+				if (!((*this)[index] == other[index])) { return false; }
+			}
+			return true;
+		}
+
+		constexpr bool operator!=(const ring_buffer& other) const {
+			return !(*this == other);
+		}
+	};
+
+	namespace pmr {
+		template <class T>
+		using ring_buffer = container::ring_buffer<T, std::pmr::polymorphic_allocator<T>>;
+	}
+}
+
+#endif
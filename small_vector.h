@@ -0,0 +1,318 @@
+#ifndef SMALL_VECTOR_CONTAINER
+#define SMALL_VECTOR_CONTAINER
+
+#include "vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace container {
+
+	/* Vector variant with a small-buffer optimization: the first InlineCapacity elements live in a
+	   buffer embedded in the object itself, so short-lived small vectors never touch the allocator.
+	   Only once the inline buffer is outgrown does storage move to the heap, after which the
+	   container behaves like container::vector. Reuses random_access::iterator from vector.h. */
+	template<typename Type, std::size_t InlineCapacity = 16, typename Allocator = std::allocator<Type>>
+	class small_vector {
+		static_assert(InlineCapacity != 0, "error: InlineCapacity cannot be 0");
+
+	private:
+		alignas(Type) unsigned char m_buffer[sizeof(Type) * InlineCapacity];
+		Type* m_data;
+		std::size_t m_capacity{ InlineCapacity };
+		std::size_t m_size{};
+		Allocator m_allocator;
+
+	public:
+		// Aliases
+		using value_type = Type;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = Type*;
+		using const_pointer = const pointer;
+		using allocator_type = Allocator;
+		using const_alloc_reference = const allocator_type&;
+		using size_type = std::size_t;
+		using init_list_type = std::initializer_list<Type>;
+		using iterator = random_access::iterator<Type>;
+		using const_iterator = random_access::iterator<const Type>;
+		using difference_type = std::ptrdiff_t;
+
+	private:
+		constexpr Type* inline_buffer() noexcept {
+			return std::launder(reinterpret_cast<Type*>(m_buffer));
+		}
+
+		constexpr const Type* inline_buffer() const noexcept {
+			return std::launder(reinterpret_cast<const Type*>(m_buffer));
+		}
+
+		constexpr bool is_inline() const noexcept {
+			return m_data == inline_buffer();
+		}
+
+		constexpr void destruct_all() noexcept {
+			for (size_type index{ 0 }; index < m_size; ++index)
+				std::allocator_traits<allocator_type>::destroy(m_allocator, m_data + index);
+			m_size = 0;
+		}
+
+		// Moves every element into fresh storage of the given capacity; used both when outgrowing
+		// the inline buffer and for later heap-to-heap growth.
+		constexpr void relocate_to_heap(size_type capacity) {
+			Type* heap = std::allocator_traits<allocator_type>::allocate(m_allocator, capacity);
+			for (size_type index{ 0 }; index < m_size; ++index) {
+				std::allocator_traits<allocator_type>::construct(m_allocator, heap + index, std::move_if_noexcept(m_data[index]));
+				std::allocator_traits<allocator_type>::destroy(m_allocator, m_data + index);
+			}
+			if (!is_inline())
+				std::allocator_traits<allocator_type>::deallocate(m_allocator, m_data, m_capacity);
+			m_data = heap;
+			m_capacity = capacity;
+		}
+
+		constexpr void grow() {
+			relocate_to_heap(m_capacity * constants::realloc_factor);
+		}
+
+		// Steals the other small_vector's heap block when it has one, and moves element-by-element
+		// when the other is still inline (its buffer dies with it, so the pointer cannot be taken).
+		constexpr void move_from(small_vector&& other) noexcept {
+			if (other.is_inline()) {
+				m_data = inline_buffer();
+				m_capacity = InlineCapacity;
+				m_size = other.m_size;
+				for (size_type index{ 0 }; index < m_size; ++index) {
+					std::allocator_traits<allocator_type>::construct(m_allocator, m_data + index, std::move(other.m_data[index]));
+					std::allocator_traits<allocator_type>::destroy(m_allocator, other.m_data + index);
+				}
+			}
+			else {
+				m_data = other.m_data;
+				m_capacity = other.m_capacity;
+				m_size = other.m_size;
+			}
+			other.m_data = other.inline_buffer();
+			other.m_capacity = InlineCapacity;
+			other.m_size = 0;
+		}
+
+	public:
+		// Constructors
+		constexpr small_vector() noexcept : m_data{ inline_buffer() } {}
+
+		constexpr explicit small_vector(const_alloc_reference allocator) noexcept
+			: m_data{ inline_buffer() }
+			, m_allocator{ allocator } {}
+
+		constexpr explicit small_vector(size_type length, const_reference value, const_alloc_reference allocator = Allocator())
+			: m_data{ inline_buffer() }
+			, m_allocator{ allocator } {
+			reserve(length);
+			for (size_type index{ 0 }; index < length; ++index)
+				emplace_back(value);
+		}
+
+		constexpr explicit small_vector(size_type length, const_alloc_reference allocator = Allocator())
+			: small_vector(length, Type(), allocator) {}
+
+		constexpr explicit small_vector(init_list_type values, const_alloc_reference allocator = Allocator())
+			: m_data{ inline_buffer() }
+			, m_allocator{ allocator } {
+			reserve(values.size());
+			for (const auto& current : values)
+				emplace_back(current);
+		}
+
+		template<std::input_iterator input_iter>
+		constexpr small_vector(input_iter first, input_iter last, const_alloc_reference allocator = Allocator())
+			: m_data{ inline_buffer() }
+			, m_allocator{ allocator } {
+			reserve(static_cast<size_type>(std::distance(first, last)));
+			for (; first != last; ++first)
+				emplace_back(*first);
+		}
+
+		// Copy semantics
+		// The allocator must be initialized in the init list: polymorphic_allocator has no operator=
+		constexpr small_vector(const small_vector& other)
+			: m_data{ inline_buffer() }
+			, m_allocator{ std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.get_allocator()) } {
+			reserve(other.m_size);
+			for (size_type index{ 0 }; index < other.m_size; ++index)
+				emplace_back(other.m_data[index]);
+		}
+
+		constexpr small_vector& operator=(const small_vector& other) {
+			if (this == &other) { return *this; }
+			destruct_all();
+			if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_copy_assignment::value) {
+				m_allocator = other.get_allocator();
+			}
+			reserve(other.m_size);
+			for (size_type index{ 0 }; index < other.m_size; ++index)
+				emplace_back(other.m_data[index]);
+			return *this;
+		}
+
+		// Move semantics
+		constexpr small_vector(small_vector&& other) noexcept
+			: m_allocator{ std::move(other.m_allocator) } {
+			move_from(std::move(other));
+		}
+
+		constexpr small_vector& operator=(small_vector&& other) noexcept {
+			if (this == &other) { return *this; }
+			destruct_all();
+			if (!is_inline())
+				std::allocator_traits<allocator_type>::deallocate(m_allocator, m_data, m_capacity);
+			if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value) {
+				m_allocator = other.get_allocator();
+			}
+			move_from(std::move(other));
+			return *this;
+		}
+
+		~small_vector() noexcept {
+			destruct_all();
+			if (!is_inline())
+				std::allocator_traits<allocator_type>::deallocate(m_allocator, m_data, m_capacity);
+		}
+
+		constexpr allocator_type get_allocator() const noexcept { return m_allocator; }
+
+		// Access functions
+		constexpr reference at(size_type index) {
+			return index < size() ? m_data[index] : throw std::out_of_range("Index out of range");
+		}
+		constexpr const_reference at(size_type index) const {
+			return index < size() ? m_data[index] : throw std::out_of_range("Index out of range");
+		}
+		constexpr reference operator[](size_type index) {
+			assert(index < size() && "Index out of range"); return m_data[index];
+		}
+		constexpr const_reference operator[](size_type index) const {
+			assert(index < size() && "Index out of range"); return m_data[index];
+		}
+		constexpr pointer data() noexcept {
+			return m_data;
+		}
+		constexpr const_pointer data() const noexcept {
+			return m_data;
+		}
+		constexpr reference back() {
+			return m_data[m_size - 1];
+		}
+		constexpr const_reference back() const {
+			return m_data[m_size - 1];
+		}
+		constexpr reference front() {
+			return *m_data;
+		}
+		constexpr const_reference front() const {
+			return *m_data;
+		}
+
+		// Iterators
+		constexpr iterator begin() noexcept {
+			return m_data;
+		}
+		constexpr const_iterator begin() const noexcept {
+			return m_data;
+		}
+		constexpr const_iterator cbegin() const noexcept {
+			return m_data;
+		}
+		constexpr iterator end() noexcept {
+			return m_data + size();
+		}
+		constexpr const_iterator end() const noexcept {
+			return m_data + size();
+		}
+		constexpr const_iterator cend() const noexcept {
+			return m_data + size();
+		}
+
+		// Capacity related
+		constexpr size_type size() const noexcept {
+			return m_size;
+		}
+		constexpr size_type capacity() const noexcept {
+			return m_capacity;
+		}
+		constexpr bool empty() const noexcept {
+			return m_size == 0;
+		}
+		static constexpr size_type inline_capacity() noexcept {
+			return InlineCapacity;
+		}
+		constexpr bool uses_inline_storage() const noexcept {
+			return is_inline();
+		}
+
+		constexpr void reserve(size_type capacity) {
+			if (capacity > m_capacity)
+				relocate_to_heap(capacity);
+		}
+
+		// Modifier functions
+		constexpr void clear() noexcept {
+			destruct_all();
+		}
+
+		template<typename...Args>
+		constexpr reference emplace_back(Args&&...args) {
+			if (m_size == m_capacity)
+				grow();
+			std::allocator_traits<allocator_type>::construct(m_allocator, m_data + m_size, std::forward<Args>(args)...);
+			return m_data[m_size++];
+		}
+
+		constexpr void push_back(const Type& value) {
+			emplace_back(value);
+		}
+
+		constexpr void push_back(Type&& value) {
+			emplace_back(std::move(value));
+		}
+
+		constexpr void pop_back() noexcept {
+			std::allocator_traits<allocator_type>::destroy(m_allocator, m_data + m_size - 1);
+			m_size -= 1;
+		}
+
+		constexpr void resize(size_type count, const_reference value = value_type()) {
+			if (count < m_size) {
+				while (m_size > count)
+					pop_back();
+			}
+			else {
+				reserve(count);
+				while (m_size < count)
+					emplace_back(value);
+			}
+		}
+
+		// Overloaded operators
+		constexpr friend bool operator== (const small_vector& first, const small_vector& second) {
+			return (first.m_size == second.m_size &&
+				std::equal(first.m_data, first.m_data + first.size(), second.m_data, second.m_data + second.size()));
+		}
+		constexpr bool operator!= (const small_vector& other) const {
+			return !(*this == other);
+		}
+	};
+
+	namespace pmr {
+		template <class T, std::size_t InlineCapacity = 16>
+		using small_vector = container::small_vector<T, InlineCapacity, std::pmr::polymorphic_allocator<T>>;
+	}
+}
+
+#endif
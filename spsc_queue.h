@@ -0,0 +1,195 @@
+#ifndef SPSC_QUEUE_CONTAINER
+#define SPSC_QUEUE_CONTAINER
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/* Lock-free single-producer/single-consumer queue: a fixed power-of-two ring indexed by two
+   free-running counters, the producer's tail and the consumer's head. Each side writes only its own
+   counter (release) and reads the other's (acquire), so a handoff is one store on each side and no
+   lock is ever taken - but the guarantee really is ONE producer thread and ONE consumer thread,
+   nothing else. The counters live on separate cache lines to stop the two cores from bouncing a
+   line between them, and each side keeps a cached copy of the other's counter so the shared line is
+   only touched when the ring looks full/empty. push_n/pop_n move batches under a single pair of
+   atomic operations.
+
+   The vocabulary matches container::Queue (push/emplace/pop/front/empty/size) so a pipeline stage
+   can switch backends without rewrites; the difference is that push and pop return false instead of
+   blocking or growing when the ring is full or empty. */
+
+namespace container {
+	template<typename T, typename Allocator = std::allocator<T>>
+	class spsc_queue {
+	public:
+		using value_type = T;
+		using allocator_type = Allocator;
+		using size_type = std::size_t;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using const_alloc_reference = const allocator_type&;
+
+	private:
+		inline static constexpr std::size_t cache_line = 64;
+
+		T* m_data;
+		size_type m_mask;	// capacity - 1; capacity is a power of two
+		[[no_unique_address]] allocator_type m_allocator;
+
+		// Producer side: the tail counter plus a cached view of the consumer's head
+		alignas(cache_line) std::atomic<size_type> m_tail{ 0 };
+		size_type m_head_cache = 0;
+
+		// Consumer side: the head counter plus a cached view of the producer's tail
+		alignas(cache_line) std::atomic<size_type> m_head{ 0 };
+		size_type m_tail_cache = 0;
+
+		size_type capacity_internal() const noexcept {
+			return m_mask + 1;
+		}
+
+	public:
+		// The capacity is rounded up to a power of two so the indices wrap with a mask
+		explicit spsc_queue(size_type capacity, const_alloc_reference allocator = Allocator())
+			: m_allocator{ allocator } {
+			assert(capacity != 0 && "capacity is 0");
+			const size_type rounded = std::bit_ceil(capacity);
+			m_data = std::allocator_traits<Allocator>::allocate(m_allocator, rounded);
+			m_mask = rounded - 1;
+		}
+
+		// Not copyable or movable: two threads hold pointers to this object by design
+		spsc_queue(const spsc_queue&) = delete;
+		spsc_queue& operator=(const spsc_queue&) = delete;
+
+		~spsc_queue() {
+			const size_type tail = m_tail.load(std::memory_order_relaxed);
+			for (size_type head = m_head.load(std::memory_order_relaxed); head != tail; ++head) {
+				std::destroy_at(m_data + (head & m_mask));
+			}
+			std::allocator_traits<Allocator>::deallocate(m_allocator, m_data, m_mask + 1);
+		}
+
+		allocator_type get_allocator() const noexcept {
+			return m_allocator;
+		}
+
+		// Producer side
+		template<typename...Args>
+		bool emplace(Args&&...args) {
+			const size_type tail = m_tail.load(std::memory_order_relaxed);
+			if (tail - m_head_cache == capacity_internal()) {
+				// Looks full: refresh the cached head; only now is the shared line touched
+				m_head_cache = m_head.load(std::memory_order_acquire);
+				if (tail - m_head_cache == capacity_internal()) {
+					return false;
+				}
+			}
+			std::construct_at(m_data + (tail & m_mask), std::forward<Args>(args)...);
+			m_tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool push(const_reference value) {
+			return emplace(value);
+		}
+
+		bool push(T&& value) {
+			return emplace(std::move(value));
+		}
+
+		// Pushes up to `count` elements from `first`, returning how many went in - one pair of
+		// atomic operations for the whole batch instead of one per element
+		template<typename input_iter>
+		size_type push_n(input_iter first, size_type count) {
+			const size_type tail = m_tail.load(std::memory_order_relaxed);
+			size_type free_slots = capacity_internal() - (tail - m_head_cache);
+			if (free_slots < count) {
+				m_head_cache = m_head.load(std::memory_order_acquire);
+				free_slots = capacity_internal() - (tail - m_head_cache);
+			}
+			const size_type to_push = std::min(count, free_slots);
+			for (size_type index{ 0 }; index < to_push; ++index, ++first) {
+				std::construct_at(m_data + ((tail + index) & m_mask), *first);
+			}
+			m_tail.store(tail + to_push, std::memory_order_release);
+			return to_push;
+		}
+
+		// Consumer side
+		bool pop(reference out) {
+			const size_type head = m_head.load(std::memory_order_relaxed);
+			if (head == m_tail_cache) {
+				m_tail_cache = m_tail.load(std::memory_order_acquire);
+				if (head == m_tail_cache) {
+					return false;
+				}
+			}
+			T* slot = m_data + (head & m_mask);
+			out = std::move(*slot);
+			std::destroy_at(slot);
+			m_head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Queue-style pop: discards the front element. Returns false when the ring is empty.
+		bool pop() {
+			const size_type head = m_head.load(std::memory_order_relaxed);
+			if (head == m_tail_cache) {
+				m_tail_cache = m_tail.load(std::memory_order_acquire);
+				if (head == m_tail_cache) {
+					return false;
+				}
+			}
+			std::destroy_at(m_data + (head & m_mask));
+			m_head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Pops up to `count` elements into `out`, returning how many came out
+		template<typename output_iter>
+		size_type pop_n(output_iter out, size_type count) {
+			const size_type head = m_head.load(std::memory_order_relaxed);
+			size_type available = m_tail_cache - head;
+			if (available < count) {
+				m_tail_cache = m_tail.load(std::memory_order_acquire);
+				available = m_tail_cache - head;
+			}
+			const size_type to_pop = std::min(count, available);
+			for (size_type index{ 0 }; index < to_pop; ++index, ++out) {
+				T* slot = m_data + ((head + index) & m_mask);
+				*out = std::move(*slot);
+				std::destroy_at(slot);
+			}
+			m_head.store(head + to_pop, std::memory_order_release);
+			return to_pop;
+		}
+
+		// Peek at the oldest element. Consumer side only: the reference stays valid until this
+		// thread pops, because only the consumer can remove elements.
+		reference front() noexcept {
+			assert(!empty() && "front on an empty spsc_queue");
+			return *(m_data + (m_head.load(std::memory_order_relaxed) & m_mask));
+		}
+
+		// Observers. size() is a snapshot: exact from either endpoint thread, approximate
+		// from anywhere else.
+		size_type size() const noexcept {
+			return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+		}
+
+		bool empty() const noexcept {
+			return size() == 0;
+		}
+
+		size_type capacity() const noexcept {
+			return m_mask + 1;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef STATIC_MAP_CONTAINER
+#define STATIC_MAP_CONTAINER
+
+#include "array.h"
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+/* Fixed lookup table for data known at build time (opcode maps, config keys, unit tables): a
+   container::array of key/value pairs sorted once in the constexpr constructor, looked up with
+   binary search. Declared constexpr the whole table is baked into .rodata - zero startup cost, no
+   heap, no hashing - and the search is the branch-light "shrink by half" form, so lookups cost a
+   handful of predictable compares instead of a hash plus a probe chain. Duplicate keys are rejected
+   in the constructor, which at compile time means the build fails instead of one entry shadowing
+   another. */
+
+namespace container {
+	template<typename Key, typename Value, std::size_t N, typename Compare = std::less<Key>>
+	class static_map
+	{
+	public:
+		// Aliases
+		using key_type		 = Key;
+		using mapped_type	 = Value;
+		using value_type	 = std::pair<Key, Value>;
+		using size_type		 = std::size_t;
+		using key_compare	 = Compare;
+		using const_reference	 = const value_type&;
+		using const_iterator	 = const value_type*;
+		using const_pointer	 = const value_type*;
+		static_assert(N != 0, "error: static_map size cannot be 0");
+
+	private:
+		array<value_type, N> m_entries;
+		[[no_unique_address]] key_compare m_compare;
+
+		// Lower bound in the branch-light form: the loop always runs log2(N) rounds and the only
+		// data-dependent decision is where `base` moves, which compiles to a conditional move
+		constexpr const_iterator lower_bound(const Key& key) const noexcept
+		{
+			const value_type* base = m_entries.data();
+			size_type length = N;
+			while (length > 0) {
+				const size_type half = length / 2;
+				if (m_compare(base[half].first, key)) {
+					base += half + 1;
+					length -= half + 1;
+				}
+				else {
+					length = half;
+				}
+			}
+			return base;
+		}
+
+	public:
+		// Sorts the given entries; duplicate keys throw (a compile error when constexpr)
+		constexpr static_map(const value_type(&entries)[N], const key_compare& compare = key_compare())
+			: m_compare{ compare }
+		{
+			for (size_type index{ 0 }; index < N; ++index) {
+				m_entries[index] = entries[index];
+			}
+			std::sort(m_entries.begin(), m_entries.end(),
+				[this](const_reference left, const_reference right) { return m_compare(left.first, right.first); });
+			for (size_type index{ 1 }; index < N; ++index) {
+				if (!m_compare(m_entries[index - 1].first, m_entries[index].first)) {
+					throw std::logic_error("Error: static_map keys must be unique");
+				}
+			}
+		}
+
+		// Lookup
+		constexpr const_iterator find(const Key& key) const noexcept
+		{
+			const const_iterator candidate = lower_bound(key);
+			return (candidate != end() && !m_compare(key, candidate->first)) ? candidate : end();
+		}
+
+		constexpr bool contains(const Key& key) const noexcept	 { return find(key) != end(); }
+
+		constexpr const Value& at(const Key& key) const
+		{
+			const const_iterator found = find(key);
+			return (found != end()) ? found->second : throw std::out_of_range("Error: Key not found");
+		}
+
+		// No bound checking: the key must be present
+		constexpr const Value& operator[](const Key& key) const noexcept
+		{
+			const const_iterator found = find(key);
+			assert(found != end() && "static_map key not found");
+			return found->second;
+		}
+
+		// Size related
+		constexpr size_type size() const noexcept	 { return N; }
+		constexpr size_type max_size() const noexcept	 { return N; }
+		constexpr bool empty() const noexcept		 { return false; }
+
+		// Iterators (entries in key order, read-only: mutating a value cannot break the ordering,
+		// but keeping the table immutable is the point of baking it into .rodata)
+		constexpr const_iterator begin() const noexcept	 { return m_entries.data(); }
+		constexpr const_iterator cbegin() const noexcept { return m_entries.data(); }
+		constexpr const_iterator end() const noexcept	 { return m_entries.data() + N; }
+		constexpr const_iterator cend() const noexcept	 { return m_entries.data() + N; }
+	};
+
+	// Deduction guide: the size comes from the braced list of pairs.
+	template<typename Key, typename Value, std::size_t N>
+	static_map(const std::pair<Key, Value>(&)[N])->static_map<Key, Value, N>;
+}
+
+#endif
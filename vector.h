@@ -7,17 +7,64 @@
 #include <cassert>
 #include <concepts>
 #include <compare>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <ranges>
 #include <type_traits>
 #include <utility>
 
+#include "container_stats.h"
+
 namespace constants {
 	inline constexpr std::size_t realloc_factor = 2;
 }
 
+namespace growth {
+	// Compile-time growth policies for container::vector. A policy provides the first capacity to
+	// allocate and the next capacity to jump to; everything resolves at compile time, so picking a
+	// policy costs nothing at runtime. Expressing the factor as Numerator/Denominator allows
+	// non-integral factors such as 3/2.
+	template<std::size_t Numerator, std::size_t Denominator = 1, std::size_t InitialCapacity = 1>
+	struct multiply {
+		static_assert(Denominator != 0, "error: growth denominator cannot be 0");
+		static_assert(Numerator > Denominator, "error: growth factor must be greater than 1");
+		static_assert(InitialCapacity != 0, "error: initial capacity cannot be 0");
+
+		static constexpr std::size_t initial_capacity = InitialCapacity;
+
+		static constexpr std::size_t next(std::size_t current) noexcept {
+			if (current == 0)
+				return InitialCapacity;
+			const std::size_t grown = current * Numerator / Denominator;
+			return grown > current ? grown : current + 1;
+		}
+	};
+
+	// Historic behaviour of container::vector: start at 1, double every time, never shrink.
+	using default_growth = multiply<constants::realloc_factor>;
+
+	// Opt-in shrink hysteresis layered over any growth policy: once occupancy stays below
+	// capacity / OccupancyDivisor, erase() trims the allocation down to one growth step above the
+	// working set, so a rebound does not immediately reallocate. Policies without these two members
+	// never shrink.
+	template<typename GrowthPolicy = default_growth, std::size_t OccupancyDivisor = 4, std::size_t MinCapacity = 16>
+	struct shrink_hysteresis : GrowthPolicy {
+		static_assert(OccupancyDivisor > 1, "error: occupancy divisor must be greater than 1");
+
+		static constexpr bool should_shrink(std::size_t size, std::size_t capacity) noexcept {
+			return capacity > MinCapacity && size < capacity / OccupancyDivisor;
+		}
+
+		static constexpr std::size_t shrink_capacity(std::size_t size, std::size_t /*capacity*/) noexcept {
+			const std::size_t target = GrowthPolicy::next(size);
+			return target < MinCapacity ? MinCapacity : target;
+		}
+	};
+}
+
 namespace random_access {
 	template<typename Type>
 	class iterator
@@ -26,12 +73,15 @@ namespace random_access {
 		Type* m_iterator;
 
 	public:
-		using value_type = Type;
-		using reference = value_type&;
-		using pointer = value_type*;
+		using value_type = std::remove_cv_t<Type>;
+		using element_type = Type;
+		using reference = Type&;
+		using pointer = Type*;
 		using iterator_category = std::random_access_iterator_tag;
 		using difference_type = std::ptrdiff_t;
-		//using iterator_concept = std::contiguous_iterator_tag;
+		// Advertising contiguity lets the standard algorithms take their pointer-based
+		// (memmove/vectorized) specializations instead of the generic element loop.
+		using iterator_concept = std::contiguous_iterator_tag;
 
 		constexpr iterator(Type* iter = nullptr) : m_iterator{ iter } {}
 
@@ -87,11 +137,13 @@ namespace random_access {
 			return first.m_iterator - other;
 		}
 
+		// Must be "this minus other" for std::sized_sentinel_for (and therefore
+		// std::contiguous_iterator) to hold; the previous version returned the reversed distance.
 		constexpr difference_type operator-(const iterator& other) const noexcept {
-			return std::distance(m_iterator, other.m_iterator);
+			return m_iterator - other.m_iterator;
 		}
 
-		constexpr reference operator[](std::size_t index) const {
+		constexpr reference operator[](difference_type index) const {
 			return m_iterator[index];
 		}
 
@@ -103,13 +155,20 @@ namespace random_access {
 
 namespace container {
 
-	template<typename Type, typename Allocator = std::allocator<Type>>
+	template<typename Type, typename Allocator = std::allocator<Type>, typename GrowthPolicy = growth::default_growth>
 	class vector {
 	private:
 		Type* m_vector;
 		std::size_t m_capacity{};
 		std::size_t m_size{};
 		Allocator m_allocator;
+		[[no_unique_address]] vector_stats m_stats;	// Empty unless CONTAINER_INSTRUMENTATION (see container_stats.h)
+
+		// Trivially copyable elements handled by the default allocator can be relocated with one bulk
+		// memcpy/memmove instead of a per-element construct/destroy loop. A custom allocator might want
+		// to observe every construct/destroy, so the fast path is disabled for those.
+		static constexpr bool is_trivially_relocatable =
+			std::is_trivially_copyable_v<Type> && std::is_same_v<Allocator, std::allocator<Type>>;
 
 		constexpr void reset(vector& other) noexcept {
 			other.m_vector = nullptr;
@@ -129,6 +188,7 @@ namespace container {
 		}
 
 		constexpr void reallocate(std::size_t old_cap, std::size_t new_cap) {
+			CONTAINER_STATS(++m_stats.reallocations);
 			deallocate(old_cap);
 			allocate(new_cap);
 		}
@@ -195,9 +255,66 @@ namespace container {
 				m_vector = nullptr;
 		}
 
+		// Replaces the contents with `count` elements read from `first`, reusing the existing
+		// allocation whenever it is large enough: copy-assign over the live prefix, copy-construct
+		// only the tail, destroy only the surplus. Allocates only when capacity is insufficient.
+		template<typename input_iter>
+		constexpr void assign_over(input_iter first, std::size_t count) {
+			if (count > m_capacity) {
+				deallocate_and_destruct(m_capacity, m_size);
+				allocate(count);
+				for (size_type index{ 0 }; index < count; ++index, ++first)
+					std::allocator_traits<allocator_type>::construct(m_allocator, m_vector + index, *first);
+				m_size = count;
+				return;
+			}
+			const size_type overlap = std::min(count, m_size);
+			for (size_type index{ 0 }; index < overlap; ++index, ++first)
+				m_vector[index] = *first;
+			for (size_type index{ overlap }; index < count; ++index, ++first)
+				std::allocator_traits<allocator_type>::construct(m_allocator, m_vector + index, *first);
+			for (size_type index{ count }; index < m_size; ++index)
+				std::allocator_traits<allocator_type>::destroy(m_allocator, m_vector + index);
+			m_size = count;
+		}
+
+		// Same idea as assign_over, but every element gets the same value
+		constexpr void assign_fill(std::size_t count, const Type& value) {
+			if (count > m_capacity) {
+				deallocate_and_destruct(m_capacity, m_size);
+				allocate(count);
+				construct(count, value);
+				return;
+			}
+			const size_type overlap = std::min(count, m_size);
+			for (size_type index{ 0 }; index < overlap; ++index)
+				m_vector[index] = value;
+			for (size_type index{ overlap }; index < count; ++index)
+				std::allocator_traits<allocator_type>::construct(m_allocator, m_vector + index, value);
+			for (size_type index{ count }; index < m_size; ++index)
+				std::allocator_traits<allocator_type>::destroy(m_allocator, m_vector + index);
+			m_size = count;
+		}
+
 		constexpr void reallocate_strong_guarantee(std::size_t capacity) {
+			CONTAINER_STATS(++m_stats.reallocations);
+			CONTAINER_STATS(++m_stats.strong_guarantee_reallocations);
+			CONTAINER_STATS(m_stats.bytes_moved += m_size * sizeof(Type));
 			Type* tempVect = std::allocator_traits<allocator_type>::allocate(m_allocator, capacity);
-			if (std::is_nothrow_move_constructible<Type>::value || !std::is_nothrow_move_constructible<Type>::value && !std::is_copy_constructible<Type>::value) {
+			if constexpr (is_trivially_relocatable) {
+				if (!std::is_constant_evaluated()) {
+					if (m_size != 0)
+						std::memcpy(tempVect, m_vector, m_size * sizeof(Type));
+					size_type temp_size = m_size;
+					if (m_vector)
+						std::allocator_traits<allocator_type>::deallocate(m_allocator, m_vector, m_capacity);
+					m_capacity = capacity;
+					m_size = temp_size;
+					m_vector = tempVect;
+					return;
+				}
+			}
+			if constexpr (std::is_nothrow_move_constructible<Type>::value || !std::is_nothrow_move_constructible<Type>::value && !std::is_copy_constructible<Type>::value) {
 				for (size_type index{ 0 }; index < m_size; ++index)
 					std::allocator_traits<allocator_type>::construct(m_allocator, tempVect + index, std::move(m_vector[index]));
 			}
@@ -229,6 +346,17 @@ namespace container {
 			// Should provide strong exception guarantee; to be updated...
 
 	
+			if constexpr (is_trivially_relocatable) {
+				if (!std::is_constant_evaluated()) {
+					// One bulk shift, then plain assignments: no construct/destroy bookkeeping needed for PODs
+					std::memmove(m_vector + index_pos + count, m_vector + index_pos, (size() - index_pos) * sizeof(Type));
+					for (std::size_t index{ 0 }; index < count; ++index)
+						m_vector[index_pos + index] = value;
+					m_size += count;
+					return;
+				}
+			}
+
 			auto count_after_last_element = m_vector + size() + count;
 			auto last_element = m_vector + size();
 			auto current_pos = m_vector + index_pos;
@@ -271,7 +399,15 @@ namespace container {
 		}
 
 		constexpr void shift_and_construct(std::size_t index_pos, Type&& value) {
-			if (std::is_nothrow_move_constructible<Type>::value || 
+			if constexpr (is_trivially_relocatable) {
+				if (!std::is_constant_evaluated()) {
+					std::memmove(m_vector + index_pos + 1, m_vector + index_pos, (size() - index_pos) * sizeof(Type));
+					m_vector[index_pos] = std::move(value);
+					m_size += 1;
+					return;
+				}
+			}
+			if (std::is_nothrow_move_constructible<Type>::value ||
 			    (!std::is_nothrow_move_constructible<Type>::value && 
 			     !std::is_copy_constructible<Type>::value)) {
 				auto one_after_last_element = m_vector + size() + 1;
@@ -297,6 +433,58 @@ namespace container {
 			m_size += 1;
 		}
 
+		// Growth slow path kept out of the append hot path so emplace_back inlines to a single
+		// capacity compare plus a construct. Not pre-multiplying m_capacity before the call also
+		// keeps reallocate_strong_guarantee's deallocation bookkeeping correct.
+		constexpr void grow_for_append() {
+			reallocate_strong_guarantee(GrowthPolicy::next(m_capacity));
+		}
+
+		// Computes the capacity needed for `required` elements once, so bulk operations reallocate
+		// at most one time instead of once per growth step.
+		constexpr void grow_to_fit(std::size_t required) {
+			size_type new_capacity = m_capacity;
+			while (new_capacity < required)
+				new_capacity = GrowthPolicy::next(new_capacity);
+			if (new_capacity != m_capacity)
+				reallocate_strong_guarantee(new_capacity);
+		}
+
+		// No-op unless the policy opts into shrinking (see growth::shrink_hysteresis); called from
+		// erase() so long-lived vectors whose size collapses give their dead capacity back.
+		constexpr void maybe_shrink() {
+			if constexpr (requires { GrowthPolicy::should_shrink(m_size, m_capacity); GrowthPolicy::shrink_capacity(m_size, m_capacity); }) {
+				if (GrowthPolicy::should_shrink(m_size, m_capacity)) {
+					const size_type target = GrowthPolicy::shrink_capacity(m_size, m_capacity);
+					if (target < m_capacity)
+						reallocate_strong_guarantee(target);
+				}
+			}
+		}
+
+		// Opens a gap of `count` raw slots at index_pos, shifting [index_pos, m_size) towards the
+		// end. Capacity must already fit m_size + count. The gap slots are left unconstructed so the
+		// caller can construct the new elements straight into them. m_size is not touched.
+		constexpr void shift_elements(std::size_t index_pos, std::size_t count) {
+			if constexpr (is_trivially_relocatable) {
+				if (!std::is_constant_evaluated()) {
+					std::memmove(m_vector + index_pos + count, m_vector + index_pos, (m_size - index_pos) * sizeof(Type));
+					return;
+				}
+			}
+			size_type tail = m_size - index_pos;
+			size_type constructed = std::min(count, tail);
+			// The last `constructed` tail elements land on uninitialized storage, so move-construct them
+			for (size_type index{ 0 }; index < constructed; ++index)
+				std::allocator_traits<allocator_type>::construct(m_allocator, m_vector + m_size + count - 1 - index, std::move(m_vector[m_size - 1 - index]));
+			// The rest of the tail moves within already-constructed storage
+			if (tail > constructed)
+				std::move_backward(m_vector + index_pos, m_vector + index_pos + (tail - constructed), m_vector + index_pos + tail);
+			// Clear out the moved-from slots inside the gap
+			for (size_type index{ 0 }; index < constructed; ++index)
+				std::allocator_traits<allocator_type>::destroy(m_allocator, m_vector + index_pos + index);
+		}
+
 		constexpr void	insert_end_strong_guarantee(Type&& value) {
 			if constexpr (std::is_nothrow_move_constructible<Type>::value)
 				std::allocator_traits<allocator_type>::construct(m_allocator, m_vector + m_size, std::move(value));
@@ -349,7 +537,7 @@ namespace container {
 
 		template<typename input_iter>
 		constexpr vector(input_iter first, input_iter last, const_alloc_reference allocator = Allocator()) {
-			size_type size = std::distance(last, first);
+			size_type size = std::distance(first, last);
 			allocate(size);
 			for (size_type index{ 0 }; index < size; ++index) {
 				std::allocator_traits<Allocator>::construct(m_allocator, m_vector + index, *(first++));
@@ -368,23 +556,21 @@ namespace container {
 			copy(other);
 		}
 
+		// Reuses the existing allocation when it already fits the source, so snapshot/restore style
+		// workloads that assign into an equally-sized vector skip the allocator entirely. The old
+		// version freed and re-allocated whenever the source was larger, and when it fit it
+		// copy-constructed over elements that were never destroyed.
 		constexpr vector& operator=(const vector& other) {
 			if (this == &other) { return *this; }
-			//destruct(size());
-			if (other.m_vector)
-			{
-				if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_copy_assignment::value) {
-					m_allocator = other.get_allocator();
-				}
-				if (other.size() > capacity()) {
-					reallocate(capacity(), other.size());
+			if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_copy_assignment::value) {
+				if (m_allocator != other.m_allocator) {
+					// Memory from the old allocator cannot be reused once we take over the new one
+					deallocate_and_destruct(m_capacity, m_size);
+					m_vector = nullptr;
 				}
-				uninitialized_alloc_copy(other);
-			}
-			else {
-				m_vector = nullptr;
-				m_size = 0;
+				m_allocator = other.get_allocator();
 			}
+			assign_over(other.m_vector, other.m_size);
 			return *this;
 		}
 
@@ -469,39 +655,32 @@ namespace container {
 		}
 
 
-		// Member functions
+		// Member functions - all assign overloads reuse existing capacity (see assign_over)
 		constexpr void assign(size_type size, const_reference value) {
-			destruct(m_size);
-			if (size > capacity()) {
-				reallocate(capacity(), size);
-			}
-			construct(size, value);
+			assign_fill(size, value);
 		}
 
 		constexpr void assign(init_list_type values) {
-			destruct(m_size);
-			if (values.size() > capacity())
-			{
-				reallocate(capacity(), values.size());
-			}
-			construct_init_list(values);
+			assign_over(values.begin(), values.size());
 		}
 
-		template<typename input_iter>
+		template<std::input_iterator input_iter>
 		constexpr void assign(input_iter first, input_iter last) {
-			size_type size = std::distance(last, first);
-			destruct(size);
-			if (size > capacity()) {
-				reallocate(capacity(), size);
+			if constexpr (std::forward_iterator<input_iter>) {
+				assign_over(first, static_cast<size_type>(std::distance(first, last)));
 			}
-			for (size_type index{ 0 }; index < size; ++index) {
-				std::allocator_traits<Allocator>::construct(m_allocator, m_vector + index, *(first + index));
-				++m_size;
+			else {
+				destruct(m_size);
+				for (; first != last; ++first)
+					emplace_back(*first);
 			}
 		}
 
 		constexpr allocator_type get_allocator() const noexcept { return m_allocator; }
 
+		// Slow-path counters, populated only under CONTAINER_INSTRUMENTATION (empty struct otherwise)
+		constexpr const vector_stats& stats() const noexcept { return m_stats; }
+
 		// Access functions
 		constexpr reference at(size_type index) {
 			return index < size() ? m_vector[index] : throw std::out_of_range("Index out of range");
@@ -611,25 +790,20 @@ namespace container {
 		}
 
 		constexpr iterator insert(const iterator pos, init_list_type values) {
-			size_type pos_index_position = std::distance(pos, begin());
+			size_type pos_index_position = std::distance(begin(), pos);
 			if (size() + values.size() < capacity()) {
 				shift_and_construct_init(pos_index_position, values);
 			}
 
 			else {
-				do {
-					if (m_capacity == 0) m_capacity = 1;
-					m_capacity *= constants::realloc_factor;
-				} while (m_capacity < values.size() + m_size);
-
-				reallocate_strong_guarantee(m_capacity);
+				grow_to_fit(m_size + values.size() + 1);
 				shift_and_construct_init(pos_index_position, values);
 			}
 			return values.size() == 0 ? pos : iterator(m_vector + pos_index_position);
 		}
 
 		constexpr iterator insert(const iterator pos, size_type count, const_reference value) {
-			size_type pos_index_position = std::distance(pos, begin());
+			size_type pos_index_position = std::distance(begin(), pos);
 			if (size() + count < capacity()) {
 				if (pos == end()) {
 					insert_end_strong_guarantee(value);
@@ -638,29 +812,76 @@ namespace container {
 					shift_and_construct(pos_index_position, value, count);
 			}
 			else {
-				do {
-					if (m_capacity == 0) m_capacity = 1;
-					m_capacity *= constants::realloc_factor;
-				} while (m_capacity < m_size);
-
-				reallocate_strong_guarantee(m_capacity);
+				// The old loop here only grew until m_capacity caught up with m_size, ignoring count
+				grow_to_fit(m_size + count + 1);
 				shift_and_construct(pos_index_position, value, count);
 			}
 			return count == 0 ? pos : iterator(m_vector + pos_index_position);
 		}
 
+		// Range insert: one growth computation and at most one reallocation for the whole batch,
+		// instead of per-element capacity checks. Requires forward iterators so the batch can be
+		// sized up front.
+		template<std::forward_iterator input_iter>
+		constexpr iterator insert(const iterator pos, input_iter first, input_iter last) {
+			size_type pos_index_position = std::distance(begin(), pos);
+			size_type count = static_cast<size_type>(std::distance(first, last));
+			if (count == 0)
+				return pos;
+			if (m_size + count > m_capacity)
+				grow_to_fit(m_size + count);
+			shift_elements(pos_index_position, count);
+			for (size_type index{ 0 }; index < count; ++index, ++first)
+				std::allocator_traits<allocator_type>::construct(m_allocator, m_vector + pos_index_position + index, *first);
+			m_size += count;
+			return iterator(m_vector + pos_index_position);
+		}
+
+		// Bulk append. Forward iterators take the sized path: capacity is computed once and the new
+		// elements are constructed straight into the uninitialized tail. Input-only iterators cannot
+		// be sized without consuming them, so they fall back to repeated emplace_back.
+		template<std::input_iterator input_iter>
+		constexpr void append(input_iter first, input_iter last) {
+			if constexpr (std::forward_iterator<input_iter>) {
+				size_type count = static_cast<size_type>(std::distance(first, last));
+				if (count == 0)
+					return;
+				if (m_size + count > m_capacity)
+					grow_to_fit(m_size + count);
+				for (size_type index{ 0 }; index < count; ++index, ++first)
+					std::allocator_traits<allocator_type>::construct(m_allocator, m_vector + m_size + index, *first);
+				m_size += count;
+			}
+			else {
+				for (; first != last; ++first)
+					emplace_back(*first);
+			}
+		}
+
+		template<std::ranges::input_range Range>
+		constexpr void append_range(Range&& range) {
+			append(std::ranges::begin(range), std::ranges::end(range));
+		}
+
 		constexpr iterator erase(const iterator pos) {
 			assert(pos <= end() && "Vector subscript out of range");
-			size_type pos_index_position = std::distance(pos, begin());
+			size_type pos_index_position = std::distance(begin(), pos);
 			std::allocator_traits<allocator_type>::destroy(m_allocator, m_vector + pos_index_position);
-			if constexpr (std::is_nothrow_move_constructible<Type>::value) {
+			if constexpr (is_trivially_relocatable) {
+				if (!std::is_constant_evaluated())
+					std::memmove(m_vector + pos_index_position, m_vector + pos_index_position + 1, (size() - pos_index_position - 1) * sizeof(Type));
+				else
+					std::move(m_vector + pos_index_position + 1, m_vector + size(), m_vector + pos_index_position);
+			}
+			else if constexpr (std::is_nothrow_move_constructible<Type>::value) {
 				std::move(m_vector + pos_index_position + 1, m_vector + size(), m_vector + pos_index_position);
 			}
 
 			else
 				std::copy(m_vector + pos_index_position + 1, m_vector + size(), m_vector + pos_index_position);
 			--m_size;
-			return (end() == pos) ? end() : iterator(m_vector + pos_index_position);
+			maybe_shrink();
+			return (pos_index_position == size()) ? end() : iterator(m_vector + pos_index_position);
 		}
 
 		constexpr iterator erase(const iterator first, const iterator last) {
@@ -668,19 +889,26 @@ namespace container {
 			assert(first <= end() && "Vector's first argument out of range");
 			assert(last <= end() && "Vector's second argument out of range");
 			assert(first <= last && "Vector's first argument smaller than second argument");
-			size_type first_position = std::distance(first, begin());
-			size_type last_position = std::distance(last, begin());
+			size_type first_position = std::distance(begin(), first);
+			size_type last_position = std::distance(begin(), last);
 			size_type difference{ last_position - first_position };
 			for (size_type index{ first_position }; index < last_position; ++index) {
 				std::allocator_traits<allocator_type>::destroy(m_allocator, m_vector + index);
 			}
-			if constexpr (std::is_nothrow_move_constructible<Type>::value) {
+			if constexpr (is_trivially_relocatable) {
+				if (!std::is_constant_evaluated())
+					std::memmove(m_vector + first_position, m_vector + last_position, (size() - last_position) * sizeof(Type));
+				else
+					std::move(m_vector + last_position, m_vector + size(), m_vector + first_position);
+			}
+			else if constexpr (std::is_nothrow_move_constructible<Type>::value) {
 				std::move(m_vector + last_position, m_vector + size(), m_vector + first_position);
 			}
 			else
 				std::copy(m_vector + last_position, m_vector + size(), m_vector + first_position);
 			m_size -= difference;
-			return (last_equals_end) ? iterator(m_vector + last_position) : iterator(m_vector + first_position);
+			maybe_shrink();
+			return (last_equals_end) ? end() : iterator(m_vector + first_position);
 		}
 
 		constexpr void pop_back() noexcept {
@@ -702,10 +930,34 @@ namespace container {
 			}
 		}
 
+		// Grows size without touching the new elements, so read()/recv() style calls can write the
+		// bytes in place instead of paying for a value-construction pass that is overwritten anyway.
+		// Only available for trivial types, where "uninitialized" is a valid object state.
+		constexpr void resize_uninitialized(size_type count)
+			requires (std::is_trivially_default_constructible_v<Type> && std::is_trivially_destructible_v<Type>)
+		{
+			if (count > m_capacity)
+				grow_to_fit(count);
+			m_size = count;
+		}
+
+		// resize_and_overwrite in the style of std::string: makes count writable elements available,
+		// lets op(data, count) fill them, and adopts op's return value as the new size.
+		template<typename Operation>
+		constexpr void resize_and_overwrite(size_type count, Operation op)
+			requires (std::is_trivially_default_constructible_v<Type> && std::is_trivially_destructible_v<Type>)
+		{
+			if (count > m_capacity)
+				grow_to_fit(count);
+			size_type new_size = static_cast<size_type>(std::move(op)(m_vector, count));
+			assert(new_size <= count && "resize_and_overwrite operation returned a size larger than requested");
+			m_size = new_size;
+		}
+
 		template<typename...Args>
 		constexpr iterator emplace(const iterator pos, Args&&...args) { // Provide strong guarantee
 			assert(pos <= end() && "Vector's argument out of range");
-			size_type pos_index_position = std::distance(pos, begin());
+			size_type pos_index_position = std::distance(begin(), pos);
 
 			if (size() + 1 < capacity()) {
 				if (pos == end()) {
@@ -723,21 +975,22 @@ namespace container {
 				}
 			}
 			else {
-				do {
-					if (m_capacity == 0) m_capacity = 1;
-					m_capacity *= constants::realloc_factor;
-				} while (m_capacity < 1 + size());
-				reallocate_strong_guarantee(m_capacity);
+				grow_to_fit(m_size + 2);
 				shift_and_construct(pos_index_position, std::forward<Args>(args)...); // Checks if move constructor is noexcept. Otherwise does copy
 			}
 
 			return iterator(m_vector + pos_index_position);
 		}
 
+		// Dedicated append path: unlike routing through the general emplace(), this performs no
+		// std::distance, no position checks and no shifting - just one capacity branch and a
+		// perfect-forwarded construct at m_vector + m_size.
 		template<typename...Args>
-		constexpr reference emplace_back(Args...args) {
-			emplace(end(), std::forward<Args>(args)...);
-			return *(m_vector + size() - 1);
+		constexpr reference emplace_back(Args&&...args) {
+			if (m_size == m_capacity)
+				grow_for_append();
+			std::allocator_traits<allocator_type>::construct(m_allocator, m_vector + m_size, std::forward<Args>(args)...);
+			return m_vector[m_size++];
 		}
 
 		constexpr void push_back(const Type& value) {
@@ -761,16 +1014,16 @@ namespace container {
 	};
 
 	// Erase, erase_if
-	template<typename Type, typename Allocator, typename Val>
-	constexpr auto erase(container::vector<Type, Allocator>& vec, const Val& value) {
+	template<typename Type, typename Allocator, typename GrowthPolicy, typename Val>
+	constexpr auto erase(container::vector<Type, Allocator, GrowthPolicy>& vec, const Val& value) {
 		auto iter = std::remove(vec.begin(), vec.end(), value);
 		auto dist = std::distance(iter, vec.end());
 		vec.erase(iter, vec.end());
 		return dist;
 	}
 
-	template<typename Type, typename Allocator, typename Predicate>
-	constexpr auto erase_if(container::vector<Type, Allocator>& vec, Predicate predicate) {
+	template<typename Type, typename Allocator, typename GrowthPolicy, typename Predicate>
+	constexpr auto erase_if(container::vector<Type, Allocator, GrowthPolicy>& vec, Predicate predicate) {
 		auto iter = std::remove_if(vec.begin(), vec.end(), predicate);
 		auto dist = std::distance(iter, vec.end());
 		vec.erase(iter, vec.end());
@@ -782,6 +1035,14 @@ namespace container {
 		template <class T>
 		using vector = container::vector<T, std::pmr::polymorphic_allocator<T>>;
 	}
+
+	// Compile-time proof that the iterator genuinely models std::contiguous_iterator and the vector
+	// models std::ranges::contiguous_range - this is what unlocks the pointer-based algorithm
+	// specializations in the standard library.
+	static_assert(std::contiguous_iterator<random_access::iterator<int>>);
+	static_assert(std::contiguous_iterator<random_access::iterator<const int>>);
+	static_assert(std::ranges::contiguous_range<container::vector<int>>);
+	static_assert(std::sized_sentinel_for<random_access::iterator<int>, random_access::iterator<int>>);
 }
 
 #endif
@@ -0,0 +1,145 @@
+#ifndef WORK_STEALING_DEQUE_CONTAINER
+#define WORK_STEALING_DEQUE_CONTAINER
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+/* Work-stealing variant of container::Stack for per-worker task piles, after Chase and Lev (with
+   the memory orderings of Le et al.'s C11 formulation). The owner thread pushes and pops at the
+   bottom like a plain stack - no synchronization beyond one fence in the common case - while idle
+   workers steal() from the top end through a CAS, so a deep pile drains from both sides instead of
+   leaving cores idle. LIFO for the owner keeps its working set hot; FIFO for thieves hands them the
+   oldest (usually largest) tasks.
+
+   The ring is bounded: push returns false when the deque is full, which a scheduler treats the
+   same way as a full local queue (run the task inline or hand it off). T must be trivially
+   copyable - task handles and function pointers are the intended cargo - because stolen slots are
+   read concurrently with the CAS that claims them. Owner calls are push/pop/empty/size, matching
+   the Stack vocabulary; steal() is the only entry point for other threads. */
+
+namespace container {
+	template<typename T, typename Allocator = std::allocator<T>>
+	class work_stealing_deque {
+		static_assert(std::is_trivially_copyable_v<T>, "error: elements must be trivially copyable (store task handles or pointers)");
+
+	public:
+		using value_type = T;
+		using allocator_type = Allocator;
+		using size_type = std::size_t;
+		using const_alloc_reference = const allocator_type&;
+
+	private:
+		inline static constexpr std::size_t cache_line = 64;
+		using slot_type = std::atomic<T>;
+		using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<slot_type>;
+		using slot_alloc_traits = std::allocator_traits<slot_allocator>;
+
+		slot_type* m_buffer;
+		std::size_t m_mask;		// capacity - 1; capacity is a power of two
+		[[no_unique_address]] slot_allocator m_allocator;
+
+		// Owner and thieves write different counters; separate cache lines keep them from
+		// bouncing a line between cores
+		alignas(cache_line) std::atomic<std::int64_t> m_top{ 0 };	// Steal end
+		alignas(cache_line) std::atomic<std::int64_t> m_bottom{ 0 };	// Owner end
+
+	public:
+		explicit work_stealing_deque(size_type capacity, const_alloc_reference allocator = Allocator())
+			: m_allocator{ allocator } {
+			assert(capacity != 0 && "capacity is 0");
+			const size_type rounded = std::bit_ceil(capacity);
+			m_buffer = slot_alloc_traits::allocate(m_allocator, rounded);
+			for (size_type index{ 0 }; index < rounded; ++index) {
+				std::construct_at(m_buffer + index);
+			}
+			m_mask = rounded - 1;
+		}
+
+		// Not copyable or movable: worker and thief threads hold pointers to this object
+		work_stealing_deque(const work_stealing_deque&) = delete;
+		work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+		~work_stealing_deque() {
+			slot_alloc_traits::deallocate(m_allocator, m_buffer, m_mask + 1);
+		}
+
+		// Owner side. push returns false when the ring is full - run the task inline instead.
+		bool push(T value) {
+			const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+			const std::int64_t top = m_top.load(std::memory_order_acquire);
+			if (bottom - top > static_cast<std::int64_t>(m_mask)) {
+				return false;
+			}
+			m_buffer[bottom & static_cast<std::int64_t>(m_mask)].store(value, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/* Owner side, LIFO end. The only synchronization in the common case is the seq_cst fence
+		ordering the bottom decrement against the stealers' reads; a CAS happens solely when owner
+		and a thief race for the final element. */
+		bool pop(T& out) {
+			const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+			m_bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::int64_t top = m_top.load(std::memory_order_relaxed);
+			if (top <= bottom) {
+				out = m_buffer[bottom & static_cast<std::int64_t>(m_mask)].load(std::memory_order_relaxed);
+				if (top == bottom) {
+					// Last element: win the race against any concurrent steal or concede
+					const bool won = m_top.compare_exchange_strong(top, top + 1,
+						std::memory_order_seq_cst, std::memory_order_relaxed);
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+					return won;
+				}
+				return true;
+			}
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);	// Deque was empty
+			return false;
+		}
+
+		/* Any other thread, FIFO end. Returns false on an empty deque or a lost race - callers
+		loop over victims anyway, so a spurious failure just means trying the next one. */
+		bool steal(T& out) {
+			std::int64_t top = m_top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+			if (top < bottom) {
+				out = m_buffer[top & static_cast<std::int64_t>(m_mask)].load(std::memory_order_relaxed);
+				if (!m_top.compare_exchange_strong(top, top + 1,
+					std::memory_order_seq_cst, std::memory_order_relaxed)) {
+					return false;
+				}
+				return true;
+			}
+			return false;
+		}
+
+		// Observers: snapshots, exact only from the owner thread while no steal is in flight
+		size_type size() const noexcept {
+			const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+			const std::int64_t top = m_top.load(std::memory_order_relaxed);
+			return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+		}
+
+		bool empty() const noexcept {
+			return size() == 0;
+		}
+
+		size_type capacity() const noexcept {
+			return m_mask + 1;
+		}
+
+		allocator_type get_allocator() const noexcept {
+			return allocator_type(m_allocator);
+		}
+	};
+}
+
+#endif